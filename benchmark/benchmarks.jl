@@ -3,11 +3,112 @@ using UnROOT
 
 const SUITE = BenchmarkGroup()
 
+const samplesdir = joinpath(pkgdir(UnROOT), "test", "samples")
+# large input generated with `makebench` from test/samples/tree_with_varfix_doubly_jagged.C
+# (run it in this directory), the tiny committed samples are used otherwise
+const jaggedbench = joinpath(@__DIR__, "doubly_jagged_bench.root")
+
 SUITE["Latency"] = BenchmarkGroup()
 const l1 = UnROOT.samplefile("NanoAODv5_sample.root")
 SUITE["Latency"]["load NanoAOD"] = @benchmarkable LazyTree(l1, "Events") samples=1 evals=1
+# opening a fresh file each time, with and without the sidecar metadata index
+const l1index = ROOTFile(f -> UnROOT.write_metadata_index(f, joinpath(mktempdir(), "nanoaod.unrootindex")), l1.filename)
+_open_nanoaod(; kwargs...) = ROOTFile(f -> length(LazyTree(f, "Events")), l1.filename; kwargs...)
+SUITE["Latency"]["open NanoAOD"] = @benchmarkable _open_nanoaod()
+SUITE["Latency"]["open NanoAOD, metadata index"] = @benchmarkable _open_nanoaod(metadata_index=l1index)
 
 
 SUITE["Performance"] = BenchmarkGroup()
 const p1 = LazyTree(UnROOT.samplefile("RNTuple/test_ntuple_int_multicluster.root"), "ntuple")
 SUITE["Performance"]["read RNTuple multicluster"] = @benchmarkable p1.one_integers[1] samples=1 evals=1
+
+
+SUITE["Prefetch"] = BenchmarkGroup()
+# sequential read of a single branch (the only one registered for the read-ahead) of a tree
+# with many clusters, so that there is something to read ahead:
+# the `makebench` input if present, the 18 clusters sample otherwise
+const prefetchinput = isfile(jaggedbench) ? (jaggedbench, "outtree", "v") :
+                      (joinpath(samplesdir, "tree_with_clusters.root"), "t1", "b2")
+function _sum_column(lb)
+    s = 0.0
+    for row in lb
+        for x in row
+            s += x
+        end
+    end
+    return s
+end
+for depth in (0, 2)
+    path, tree, col = prefetchinput
+    SUITE["Prefetch"]["sequential $tree/$col, prefetch=$depth"] = @benchmarkable _sum_column(getproperty(t, Symbol($col))) setup=(f = ROOTFile($path); t = LazyTree(f, $tree, [$col]; prefetch=$depth)) teardown=close(f) evals=1
+end
+
+
+SUITE["Pushdown"] = BenchmarkGroup()
+# cut on `b1` keeping the last `selectivity` fraction of rows, then sum the payload `b2`
+function _pushdown(f, selectivity)
+    t = LazyTree(f, "t1")
+    cut = length(t) * (1 - selectivity)
+    idx = UnROOT.filterentries(evt -> evt.b1[1] >= cut, t, :b1)
+    return sum(sum, view(t, idx).b2; init=0)
+end
+for s in (0.01, 0.1, 0.5, 1.0)
+    SUITE["Pushdown"]["selectivity=$s"] = @benchmarkable _pushdown(f, $s) setup=(f = UnROOT.samplefile("tree_with_clusters.root")) teardown=close(f) evals=1
+end
+
+
+SUITE["Jagged"] = BenchmarkGroup()
+const jaggedinputs = if isfile(jaggedbench)
+    jb = ROOTFile(jaggedbench)
+    ["jagged" => (jb, "outtree/v"), "doubly jagged" => (jb, "outtree/vv")]
+else
+    ["jagged" => (UnROOT.samplefile("tree_with_jagged_array.root"), "t1/int32_array"),
+     "doubly jagged" => (UnROOT.samplefile("tree_with_doubly_jagged.root"), "t1/bf")]
+end
+_decode_all(f, path) = sum(length, UnROOT.basketarray_iter(f, f[path]))
+for (name, (f, path)) in jaggedinputs
+    SUITE["Jagged"]["decode $name"] = @benchmarkable _decode_all($f, $path)
+end
+
+
+SUITE["Writing"] = BenchmarkGroup()
+# streaming RNTuple writer, 1M rows appended in batches of 10k
+# (start Julia with `--threads` to see the compression scale)
+const writetable = (x = rand(1_000_000), n = rand(Int32, 1_000_000), v = [rand(Float32, i % 5) for i in 1:1_000_000])
+function _write_batches(table, compression)
+    io = IOBuffer()
+    UnROOT.RNTupleWriter(io, table; compression) do w
+        for r in Iterators.partition(eachindex(table.x), 10_000)
+            append!(w, map(c -> view(c, r), table))
+        end
+    end
+    return position(io)
+end
+for compression in (0, 101, 404, 505)
+    SUITE["Writing"]["RNTuple fCompress=$compression"] = @benchmarkable _write_batches(writetable, $compression) evals=1
+end
+
+
+SUITE["Codecs"] = BenchmarkGroup()
+# read throughput per compression algorithm, with the basket cache disabled so that every
+# sample reads and decompresses again
+const ttreecodecs = ["zlib" => ("tree_with_large_array.root", "t1/float_array"),
+                     "lz4" => ("tree_with_large_array_lz4.root", "t1/float_array"),
+                     "lzma" => ("tree_with_large_array_lzma.root", "t1/float_array"),
+                     "zstd" => ("tree_with_int_array_zstd.root", "t1/a")]
+# (the RNTuple writer has no lzma), the files are written by the first sample that needs them
+const rntuplecodecs = ["none" => 0, "zlib" => 101, "lz4" => 404, "zstd" => 505]
+const rntuplecodecfiles = Dict{Int, String}()
+_rntuple_codecfile(compression) = get!(rntuplecodecfiles, compression) do
+    path = joinpath(mktempdir(), "codec_$compression.root")
+    open(io -> UnROOT.write_rntuple(io, (; x = writetable.x, n = writetable.n); compression, rntuple_name="t"), path, "w")
+    path
+end
+_read_ttree(path, branch) = ROOTFile(f -> sum(sum, UnROOT.basketarray_iter(f, f[branch])), joinpath(samplesdir, path); basketcache_size=0)
+_read_rntuple(path) = ROOTFile(f -> sum(LazyTree(f, "t").x), path; basketcache_size=0)
+for (name, (path, branch)) in ttreecodecs
+    SUITE["Codecs"]["TTree $name"] = @benchmarkable _read_ttree($path, $branch)
+end
+for (name, compression) in rntuplecodecs
+    SUITE["Codecs"]["RNTuple $name"] = @benchmarkable _read_rntuple(path) setup=(path = _rntuple_codecfile($compression))
+end
@@ -0,0 +1,33 @@
+# I/O profile (see `UnROOT.io_profile`) of one read of every input of the "Codecs" benchmarks,
+# split into the read/decompress/decode stages which the timings alone don't show:
+#
+#     julia --project=. codec_profile.jl
+using UnROOT
+
+const samplesdir = joinpath(pkgdir(UnROOT), "test", "samples")
+const table = (x = rand(1_000_000), n = rand(Int32, 1_000_000))
+
+function profile_read(readall, name, path)
+    f = ROOTFile(path; profile=true, basketcache_size=0)
+    readall(f)
+    close(f)
+    println(name)
+    display(UnROOT.io_profile(f))
+    println()
+end
+
+for (name, path, branch) in [("zlib", "tree_with_large_array.root", "t1/float_array"),
+                             ("lz4", "tree_with_large_array_lz4.root", "t1/float_array"),
+                             ("lzma", "tree_with_large_array_lzma.root", "t1/float_array"),
+                             ("zstd", "tree_with_int_array_zstd.root", "t1/a")]
+    profile_read("TTree $name", joinpath(samplesdir, path)) do f
+        sum(sum, UnROOT.basketarray_iter(f, f[branch]))
+    end
+end
+
+# (the RNTuple writer has no lzma)
+for (name, compression) in ["none" => 0, "zlib" => 101, "lz4" => 404, "zstd" => 505]
+    path = joinpath(mktempdir(), "codec_$compression.root")
+    open(io -> UnROOT.write_rntuple(io, table; compression, rntuple_name="t"), path, "w")
+    profile_read(f -> sum(LazyTree(f, "t").x), "RNTuple $name", path)
+end
@@ -1,6 +1,6 @@
 module UnROOTHTTPExt
 
-import UnROOT: AbstractSourceStream, httpstreamer, read_seek_nb
+import UnROOT: AbstractSourceStream, httpstreamer, read_seek_nb, read_ranges, _read_ranges_sequential
 import HTTP
 
 httpstreamer(url::AbstractString) = HTTPStream(url)
@@ -9,16 +9,16 @@ mutable struct HTTPStream <: AbstractSourceStream
     uri::HTTP.URI
     seekloc::Int
     size::Int
-    multipart::Bool
+    # whether the server answers multi-range requests, `nothing` until probed
+    multipart::Union{Nothing, Bool}
     scitoken::String
     function HTTPStream(uri::AbstractString; scitoken = _find_scitoken())
-        #TODO: determine multipart support
         test = HTTP.request("GET", uri,
         ("Range" => "bytes=0-3", "User-Agent" => "UnROOTjl", "Authorization" => "Bearer $scitoken")
         )
         @assert test.status==206 "bad network or wrong server"
         @assert String(test.body)=="root" "not a root file"
-        multipart = false
+        multipart = nothing
         local v
         for pair in test.headers
             if lowercase(pair[1]) == "content-range"
@@ -50,6 +50,81 @@ function read_seek_nb(fobj::HTTPStream, seek, nb)
     return b
 end
 
+# servers cap the number of ranges in one request (e.g. Apache's MaxRanges defaults to 200)
+const MAX_RANGES_PER_REQUEST = 100
+
+function read_ranges(fobj::HTTPStream, seeks, nbs)
+    if isnothing(fobj.multipart)
+        fobj.multipart = _probe_multipart(fobj)
+    end
+    fobj.multipart || return _read_ranges_sequential(fobj, seeks, nbs)
+    chunks = Vector{Vector{UInt8}}(undef, length(seeks))
+    nrequests = 0
+    for batch in Iterators.partition(eachindex(seeks, nbs), MAX_RANGES_PER_REQUEST)
+        spec = join(("$(seeks[i])-$(seeks[i]+nbs[i]-1)" for i in batch), ",")
+        hd = ("Range" => "bytes=$spec", "Authorization" => "Bearer $(fobj.scitoken)")
+        resp = HTTP.request(HTTP.stack(), "GET", fobj.uri, hd, UInt8[])
+        nrequests += 1
+        parts = _byteranges(resp)
+        for i in batch
+            chunks[i] = _slice(parts, seeks[i], nbs[i])
+        end
+    end
+    return chunks, nrequests
+end
+
+# Servers without multi-range support answer with the whole file (status 200),
+# so only look at the status line and drop the connection before the body.
+function _probe_multipart(fobj::HTTPStream)
+    status = 0
+    hd = ("Range" => "bytes=0-0,2-3", "Authorization" => "Bearer $(fobj.scitoken)")
+    HTTP.open("GET", fobj.uri, hd; status_exception=false) do http
+        status = HTTP.startread(http).status
+        status == 206 && read(http)
+    end
+    return status == 206
+end
+
+# split a (multi-)range response into `first byte => bytes` parts
+function _byteranges(resp)
+    body = resp.body
+    resp.status == 200 && return [0 => body]
+    m = match(r"multipart/byteranges;\s*boundary=\"?([^\";]+)\"?", HTTP.header(resp, "Content-Type"))
+    if isnothing(m)
+        # a single (possibly merged) range comes without the multipart envelope
+        return [_rangestart(HTTP.header(resp, "Content-Range")) => body]
+    end
+    delimiter = codeunits("--" * m[1])
+    parts = Pair{Int, Vector{UInt8}}[]
+    cursor = 1
+    while true
+        d = findnext(delimiter, body, cursor)
+        isnothing(d) && break
+        # the closing delimiter is not followed by a header block
+        h = findnext(codeunits("\r\n\r\n"), body, last(d) + 1)
+        isnothing(h) && break
+        cr = match(r"(?i)content-range:\s*bytes\s+(\d+)-(\d+)", String(body[last(d)+1:first(h)-1]))
+        isnothing(cr) && error("Multipart response part without Content-Range")
+        start, stop = parse(Int, cr[1]), parse(Int, cr[2])
+        datastart = last(h) + 1
+        push!(parts, start => body[datastart:datastart+stop-start])
+        cursor = datastart + stop - start + 1
+    end
+    return parts
+end
+
+_rangestart(contentrange) = parse(Int, match(r"bytes\s+(\d+)-", contentrange)[1])
+
+function _slice(parts, seek, nb)
+    for (start, bytes) in parts
+        lo = seek - start
+        if lo >= 0 && lo + nb <= length(bytes)
+            return bytes[lo+1:lo+nb]
+        end
+    end
+    error("Server response does not cover bytes $seek-$(seek+nb-1)")
+end
+
 # SciToken discovery https://zenodo.org/record/3937438
 function _find_scitoken()
     op1 = get(ENV, "BEARER_TOKEN", "")
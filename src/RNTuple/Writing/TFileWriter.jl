@@ -3,7 +3,7 @@ using UnROOT
 using UnROOT: RNTupleFrame, ClusterSummary, PageDescription
 using XXHashNative: xxh3_64
 using Accessors
-using Tables: istable, columntable, schema
+using Tables: istable, columntable, schema, Schema
 
 function color_diff(ary1, ary2)
     if length(ary1) != length(ary2)
@@ -86,7 +86,7 @@ function test_io(obj, expected; kw...)
     end
 end
 
-function rnt_write(io::IO, x::UnROOT.FileHeader32)
+function rnt_write(io::IO, x::Union{UnROOT.FileHeader32, UnROOT.FileHeader64})
     rnt_write(io, x.fBEGIN; legacy=true)
     rnt_write(io, x.fEND; legacy=true)
     rnt_write(io, x.fSeekFree; legacy=true)
@@ -100,7 +100,7 @@ function rnt_write(io::IO, x::UnROOT.FileHeader32)
     rnt_write(io, x.fUUID; legacy=true)
 end
 
-function rnt_write(io::IO, x::UnROOT.TKey32)
+function rnt_write(io::IO, x::Union{UnROOT.TKey32, UnROOT.TKey64})
     p = position(io)
     rnt_write(io, x.fNbytes; legacy=true)
     rnt_write(io, x.fVersion; legacy=true)
@@ -125,7 +125,7 @@ function rnt_write(io::IO, x::TFile_write)
     rnt_write(io, x.unknown; legacy=true)
 end
 
-function rnt_write(io::IO, x::UnROOT.ROOTDirectoryHeader32)
+function rnt_write(io::IO, x::Union{UnROOT.ROOTDirectoryHeader32, UnROOT.ROOTDirectoryHeader64})
     rnt_write(io, x.fVersion; legacy=true)
     rnt_write(io, x.fDatimeC; legacy=true)
     rnt_write(io, x.fDatimeM; legacy=true)
@@ -540,8 +540,8 @@ function add_field_column_record!(field_records, column_records, input_T::Type{<
     nothing
 end
 
-function schema_to_field_column_records(table)
-    input_schema = schema(table)
+schema_to_field_column_records(table) = schema_to_field_column_records(schema(table))
+function schema_to_field_column_records(input_schema::Schema)
     input_Ts = input_schema.types
     input_names = input_schema.names
     field_records = UnROOT.FieldRecord[]
@@ -566,28 +566,50 @@ function rnt_write(io::IO, x::InnerPageListWrite)
     write(io, temp_io)
 end
 
+# serialized TKey32 header (26 bytes of fixed fields) + three length-prefixed strings
+_tkey32_len(class, name, title) =
+    Int16(26 + 3 + ncodeunits(class) + ncodeunits(name) + ncodeunits(title))
+# the 64-bit TKey stores fSeekKey and fSeekPdir on 8 bytes each
+_tkey_len(bigfile::Bool, class, name, title) = _tkey32_len(class, name, title) + Int16(bigfile ? 8 : 0)
+
+# ROOT's `TFile::kStartBigFile`: records starting beyond this offset use the
+# 64-bit TKey (fVersion + 1000), and a file whose trailer lies beyond it gets the
+# 64-bit file and directory headers.
+const _RNT_START_BIGFILE = 2000000000
+# ROOT version written into the file header (6.35/01); big files store it + 1000000
+const _RNT_ROOT_VERSION = Int32(63501)
+
+function _tkey(bigfile::Bool, nbytes, objlen, fdatime, keylen, seekkey, seekpdir, class, name, title)
+    if bigfile
+        UnROOT.TKey64(nbytes, 1004, objlen, fdatime, keylen, 1, seekkey, seekpdir, class, name, title)
+    else
+        UnROOT.TKey32(nbytes, 4, objlen, fdatime, keylen, 1, seekkey, seekpdir, class, name, title)
+    end
+end
+
 """
-    generate_page_links(page_locators, compression) -> RNTuplePageTopList
+    _write_rblob_key(file::IO, nbytes, objlen, fdatime) -> pos
 
-Build the nested page-location list for a single cluster. `page_locators` is a
-vector of `(num_elements, nbytes, offset)` for each column's single page;
-`compression` is the fCompress code recorded per column.
+Write the TKey of an RBlob whose `nbytes` on-disk (`objlen` uncompressed) payload
+bytes the caller writes right after, and return the position where that payload
+starts. Blobs beyond 2 GB get a 64-bit key.
 """
-function generate_page_links(page_locators, compression::Integer)
-    outer_list = RNTuplePageOuterList{InnerPageListWrite}([])
-    for (num_elements, nbytes, pos) in page_locators
-        inner_list = InnerPageListWrite(
-            [PageDescription(num_elements, Locator(nbytes, pos))],
-            0, UInt32(compression))
-        push!(outer_list, inner_list)
+function _write_rblob_key(file::IO, nbytes::Integer, objlen::Integer, fdatime)
+    seekkey = position(file)
+    if seekkey > _RNT_START_BIGFILE
+        klen = _tkey_len(true, "RBlob", "", "")
+        rnt_write(file, _tkey(true, Int32(klen + nbytes), Int32(objlen), fdatime, klen, seekkey, 100, "RBlob", "", ""))
+    else
+        klen = _tkey32_len("RBlob", "", "")
+        rnt_write(file, RBlob(; fNbytes = Int32(klen + nbytes), fVersion = 4,
+                                fObjLen = Int32(objlen), fDatime = fdatime,
+                                fKeyLen = klen, fCycle = 1,
+                                fSeekKey = Int32(seekkey), fSeekPdir = 100,
+                                fClassName = "RBlob", fName = "", fTitle = ""))
     end
-    return RNTuplePageTopList([outer_list])
+    return position(file)
 end
 
-# serialized TKey32 header (26 bytes of fixed fields) + three length-prefixed strings
-_tkey32_len(class, name, title) =
-    Int16(26 + 3 + ncodeunits(class) + ncodeunits(name) + ncodeunits(title))
-
 """
     _write_rblob(file::IO, payload::AbstractVector{UInt8}, fdatime; compression=0) -> (pos, nbytes)
 
@@ -600,14 +622,7 @@ starts and its on-disk byte count (for locators).
 """
 function _write_rblob(file::IO, payload::AbstractVector{UInt8}, fdatime; compression::Integer=0)
     ondisk = _root_compress(payload, compression)
-    klen = _tkey32_len("RBlob", "", "")
-    key = RBlob(; fNbytes = Int32(klen + length(ondisk)), fVersion = 4,
-                  fObjLen = Int32(length(payload)), fDatime = fdatime,
-                  fKeyLen = klen, fCycle = 1,
-                  fSeekKey = Int32(position(file)), fSeekPdir = 100,
-                  fClassName = "RBlob", fName = "", fTitle = "")
-    rnt_write(file, key)
-    pos = position(file)
+    pos = _write_rblob_key(file, length(ondisk), length(payload), fdatime)
     write(file, ondisk)
     return pos, length(ondisk)
 end
@@ -633,78 +648,31 @@ end
 const RNT_DEFAULT_COMPRESSION = 100 * Const.kLZ4 + 4
 
 """
-    write_rntuple(file::IO, table; file_name="test_ntuple_minimal.root",
-                  rntuple_name="myntuple", compression=$(100 * 4 + 4))
-
-Write `table` (any Tables.jl-compatible table, e.g. a `NamedTuple` of vectors)
-into `file` as an RNTuple inside a freshly created ROOT file structure. The
-output is readable by UnROOT itself, uproot, and ROOT (≥ 6.34).
-
-Supported column element types: `Bool` (bit column), `Int8`–`Int64`,
-`UInt8`–`UInt64`, `Float16`/`Float32`/`Float64`, `String`, and (nested)
-`Vector`s of these.
-
-`compression` is a ROOT `fCompress` code (`algorithm*100 + level`); pass `0` for
-no compression. Supported algorithms: `4` LZ4 (default, level 4), `1` ZLIB,
-`5` ZSTD. Each page and the header/footer/page-list envelopes are compressed
-independently, and any block that fails to shrink is stored uncompressed.
-
-Current limitations: data is written as a single cluster with one page per
-column; struct/union columns are not supported.
+    _write_tfile_preamble(file::IO, file_name, compression, fdatime) -> (fileheader_obs, tdirectory_obs)
 
-# Example
-```julia
-julia> open("out.root", "w") do io
-           UnROOT.write_rntuple(io, (x=[1.0, 2.0], s=["a", "b"]); rntuple_name="t")
-       end
-
-julia> LazyTree("out.root", "t")
-```
+Write the ROOT file header and the top directory (the TFile key) at the start of
+`file`. The seek pointers and the sizes of the trailing records are placeholders
+until [`_write_tfile_trailer!`](@ref) patches them through the returned observables.
 """
-function write_rntuple(file::IO, table; file_name="test_ntuple_minimal.root",
-                       rntuple_name="myntuple", compression::Integer=RNT_DEFAULT_COMPRESSION)
-    if !istable(table)
-        error("RNTuple writing accepts object compatible with Tables.jl interface, got type $(typeof(table))")
-    end
-
-    input_cols = columntable(table)
-    if !allequal(map(length, values(input_cols)))
-        error("Top-level columns must have the same length")
-    end
-    input_length = length(input_cols[begin])
-
-    fdatime = _root_datime()  # real timestamp on every key
-
-    # The streamed ROOT::RNTuple anchor is wrapped in a 6-byte object preamble
-    # (4-byte (kByteCountMask | byte count) + 2-byte class version, big-endian)
-    # and followed by an 8-byte xxhash checksum.
-    anchor_payload_nbytes = 64        # 4×UInt16 + 7×UInt64
-    anchor_class_version = 2
-    anchor_preamble_nbytes = 6
-    anchor_objlen = Int32(anchor_preamble_nbytes + anchor_payload_nbytes + 8)
-
+function _write_tfile_preamble(file::IO, file_name, compression::Integer, fdatime)
     # name-dependent sizes of the TFile container records
     klen_tfile = _tkey32_len("TFile", file_name, "")
     tnamed_len = 2 + ncodeunits(file_name)            # (1+name) + (1+empty title)
     fNbytesName = Int32(klen_tfile + tnamed_len)
-    tfile_objlen = Int32(tnamed_len + 30 + 30)        # TNamed + directory header + padding
-    klen_dir = _tkey32_len("", file_name, "")
-    klen_anchor = _tkey32_len("ROOT::RNTuple", rntuple_name, "")
-    fNbytesKeys = Int32(klen_dir + 4 + klen_anchor)
-    klen_end = _tkey32_len("", file_name, "")
-    fNbytesFree = Int32(klen_end + 10)
-    fNbytesInfo = Int32(64 + length(Stubs.tsreamerinfo_compressed))  # constant streamer record
+    # TNamed + directory header + padding; the padding leaves room for the
+    # 64-bit directory header of a big file
+    tfile_objlen = Int32(tnamed_len + 30 + 30)
 
     # file format magic + on-disk format version (what readers check)
     write(file, b"root")
-    rnt_write(file, Int32(63501); legacy=true)
+    rnt_write(file, _RNT_ROOT_VERSION; legacy=true)
     fileheader = UnROOT.FileHeader32(
         100,                  # fBEGIN
         0, 0,                 # fEND, fSeekFree (patched at the end)
-        fNbytesFree, 1,       # fNbytesFree, nfree
+        0, 1,                 # fNbytesFree (patched), nfree
         fNbytesName, 0x04,
         Int32(compression),   # fCompress
-        0, fNbytesInfo,       # fSeekInfo (patched), fNbytesInfo
+        0, 0,                 # fSeekInfo, fNbytesInfo (patched)
         zeros(SVector{18,UInt8}))
     fileheader_obs = rnt_write_observe(file, fileheader)
     write(file, zeros(UInt8, 100 - position(file)))   # zero-pad up to fBEGIN
@@ -714,72 +682,40 @@ function write_rntuple(file::IO, table; file_name="test_ntuple_minimal.root",
                                   klen_tfile, 1, 100, 0, "TFile", file_name, ""))
     rnt_write(file, UnROOT.TFile_write(file_name, ""))
     tdirectory32 = UnROOT.ROOTDirectoryHeader32(5, fdatime, fdatime,
-                                                fNbytesKeys, fNbytesName, 100, 0,
-                                                0)  # fSeekKeys patched below
+                                                0, fNbytesName, 100, 0,
+                                                0)  # fNbytesKeys, fSeekKeys patched
     tdirectory32_obs = rnt_write_observe(file, tdirectory32)
     # TUUID (version + 16 bytes) and reserved tail of the directory record; the
     # reader does not use these, so a zeroed UUID is sufficient.
     rnt_write(file, Stubs.dummy_padding2)
+    return fileheader_obs, tdirectory32_obs
+end
 
-    # RNTuple header envelope. The writer identifier honestly reports UnROOT.jl
-    # (not a ROOT version) per the ROOT team's request not to impersonate ROOT.
-    field_records, col_records = schema_to_field_column_records(table)
-    writer_identifier = "UnROOT.jl $(pkgversion(@__MODULE__))"
-    rnt_header = UnROOT.RNTupleHeader(
-        zero(UInt64), rntuple_name, "", writer_identifier,
-        field_records, col_records,
-        UnROOT.AliasRecord[], UnROOT.ExtraTypeInfo[])
-    header_bytes = _buffer_bytes(io -> rnt_write(io, rnt_header))
-    fSeekHeader, header_nbytes = _write_rblob(file, header_bytes, fdatime; compression)
-
-    # pages (one page per column, one cluster), all in one RBlob. Each page is
-    # compressed independently and carries an XxHash-3 checksum of its on-disk
-    # (compressed) bytes, so the per-column locators can point inside the blob.
-    pages_arys = mapreduce(rnt_col_to_ary, vcat, input_cols)
-    @assert length(pages_arys) == length(col_records)
-    pages = [rnt_ary_to_page(ary, cr) for (ary, cr) in zip(pages_arys, col_records)]
-    page_ondisk = [_root_compress(p.data, compression) for p in pages]
-    pages_payload = _buffer_bytes() do io
-        for od in page_ondisk
-            write(io, od)
-            write(io, xxh3_64(od))   # checksum over the on-disk (compressed) bytes
-        end
-    end
-    pages_begin, _ = _write_rblob(file, pages_payload, fdatime)  # container itself not re-compressed
-    page_locators = Vector{Tuple{Int32,Int64,Int64}}(undef, length(pages))
-    let pos = pages_begin
-        for i in eachindex(pages)
-            nbytes = length(page_ondisk[i])
-            page_locators[i] = (pages[i].num_elements, nbytes, pos)
-            pos += nbytes + 8  # on-disk data + xxh3 checksum
-        end
-    end
+"""
+    _write_tfile_trailer!(file::IO, rnt_anchor, fileheader_obs, tdirectory_obs;
+                          file_name, rntuple_name, fdatime, bigfile)
+
+Write the RNTuple anchor key, the directory key listing, the streamer info and the
+free-segments record at the current position, then patch the records written by
+[`_write_tfile_preamble`](@ref). With `bigfile` (the default once the trailer starts
+beyond 2 GB) the trailing keys, the file header and the directory header are
+written in their 64-bit variants.
+"""
+function _write_tfile_trailer!(file::IO, rnt_anchor, fileheader_obs, tdirectory_obs;
+                               file_name, rntuple_name, fdatime,
+                               bigfile::Bool = position(file) > _RNT_START_BIGFILE)
+    # The streamed ROOT::RNTuple anchor is wrapped in a 6-byte object preamble
+    # (4-byte (kByteCountMask | byte count) + 2-byte class version, big-endian)
+    # and followed by an 8-byte xxhash checksum.
+    anchor_payload_nbytes = 64        # 4×UInt16 + 7×UInt64
+    anchor_class_version = 2
+    anchor_preamble_nbytes = 6
+    anchor_objlen = Int32(anchor_preamble_nbytes + anchor_payload_nbytes + 8)
 
-    # page list envelope
-    header_checksum = _checksum(rnt_header)
-    cluster_summary = Write_RNTupleListFrame([ClusterSummary(0, input_length)])
-    nested_page_locations = generate_page_links(page_locators, compression)
-    pagelink = PageLinkWrite(header_checksum, cluster_summary.payload, nested_page_locations)
-    pagelink_bytes = _buffer_bytes(io -> rnt_write(io, pagelink))
-    pagelink_pos, pagelink_nbytes = _write_rblob(file, pagelink_bytes, fdatime; compression)
-
-    # footer envelope
-    rnt_footer = UnROOT.RNTupleFooter(0, header_checksum, UnROOT.RNTupleSchemaExtension([], [], [], []), [
-        UnROOT.ClusterGroupRecord(0, input_length, 1,
-            UnROOT.EnvLink(length(pagelink_bytes), UnROOT.Locator(pagelink_nbytes, pagelink_pos))),
-    ])
-    footer_bytes = _buffer_bytes(io -> rnt_write(io, rnt_footer))
-    fSeekFooter, footer_nbytes = _write_rblob(file, footer_bytes, fdatime; compression)
-
-    # anchor: all locator values are known by now, no patching needed.
-    # fNBytes* is the on-disk (compressed) size; fLen* is the uncompressed size.
-    rnt_anchor = UnROOT.ROOT_3a3a_RNTuple(1, 0, 0, 0,
-        fSeekHeader, header_nbytes, length(header_bytes),
-        fSeekFooter, footer_nbytes, length(footer_bytes),
-        0x0000000040000000, 0)  # checksum computed in rnt_write
-    tkey32_anchor = UnROOT.TKey32(klen_anchor + anchor_objlen, 4, anchor_objlen, fdatime,
-                                  klen_anchor, 1, position(file), 100, "ROOT::RNTuple", rntuple_name, "")
-    rnt_write(file, tkey32_anchor)
+    klen_anchor = _tkey_len(bigfile, "ROOT::RNTuple", rntuple_name, "")
+    tkey_anchor = _tkey(bigfile, klen_anchor + anchor_objlen, anchor_objlen, fdatime,
+                        klen_anchor, position(file), 100, "ROOT::RNTuple", rntuple_name, "")
+    rnt_write(file, tkey_anchor)
     # object preamble for the streamed anchor: byte count (covering the version
     # word + payload, no checksum) | kByteCountMask, then the class version
     rnt_write(file, UInt32(Const.kByteCountMask | (2 + anchor_payload_nbytes)); legacy=true)
@@ -787,31 +723,116 @@ function write_rntuple(file::IO, table; file_name="test_ntuple_minimal.root",
     rnt_write(file, rnt_anchor)
 
     # directory key listing (1 key: the anchor)
-    tdirectory32_obs[:fSeekKeys] = Int32(position(file))
-    rnt_write(file, UnROOT.TKey32(fNbytesKeys, 4, Int32(4 + klen_anchor), fdatime,
-                                  klen_dir, 1, position(file), 100, "", file_name, ""))
+    fSeekKeys = position(file)
+    klen_dir = _tkey_len(bigfile, "", file_name, "")
+    fNbytesKeys = Int32(klen_dir + 4 + klen_anchor)
+    rnt_write(file, _tkey(bigfile, fNbytesKeys, Int32(4 + klen_anchor), fdatime,
+                          klen_dir, fSeekKeys, 100, "", file_name, ""))
     rnt_write(file, Int32(1); legacy=true)  # number of keys in this directory
-    rnt_write(file, tkey32_anchor)
+    rnt_write(file, tkey_anchor)
 
     # streamer info (constant compressed TList blob describing ROOT::RNTuple;
     # name-independent, so kept verbatim)
-    fileheader_obs[:fSeekInfo] = UInt32(position(file))
-    rnt_write(file, UnROOT.TKey32(fNbytesInfo, 4, 1254, fdatime,
-                                  64, 1, position(file), 100, "TList", "StreamerInfo", "Doubly linked list"))
+    fSeekInfo = position(file)
+    klen_info = _tkey_len(bigfile, "TList", "StreamerInfo", "Doubly linked list")
+    fNbytesInfo = Int32(klen_info + length(Stubs.tsreamerinfo_compressed))
+    rnt_write(file, _tkey(bigfile, fNbytesInfo, 1254, fdatime,
+                          klen_info, fSeekInfo, 100, "TList", "StreamerInfo", "Doubly linked list"))
     rnt_write(file, Stubs.tsreamerinfo_compressed)
 
-    # free-segments record: one segment [fEND, 2000000000]
+    # free-segments record: one segment [fEND, last]
     fSeekFree = position(file)
-    fileheader_obs[:fSeekFree] = UInt32(fSeekFree)
+    klen_end = _tkey_len(bigfile, "", file_name, "")
+    free_objlen = bigfile ? 18 : 10
+    fNbytesFree = Int32(klen_end + free_objlen)
     fEND = fSeekFree + fNbytesFree
-    rnt_write(file, UnROOT.TKey32(fNbytesFree, 4, 10, fdatime,
-                                  klen_end, 1, fSeekFree, 100, "", file_name, ""))
-    rnt_write(file, UInt16(1); legacy=true)        # TFree version
-    rnt_write(file, UInt32(fEND); legacy=true)     # first free byte
-    rnt_write(file, UInt32(2000000000); legacy=true)
+    rnt_write(file, _tkey(bigfile, fNbytesFree, free_objlen, fdatime,
+                          klen_end, fSeekFree, 100, "", file_name, ""))
+    if bigfile
+        # TFree version + 1000 with 64-bit bounds; like ROOT, the last free byte
+        # grows in steps of 1e9 past kStartBigFile
+        last = Int64(_RNT_START_BIGFILE) + cld(max(fEND - _RNT_START_BIGFILE, 0), 1_000_000_000) * 1_000_000_000
+        rnt_write(file, UInt16(1001); legacy=true)
+        rnt_write(file, Int64(fEND); legacy=true)
+        rnt_write(file, last; legacy=true)
+    else
+        rnt_write(file, UInt16(1); legacy=true)        # TFree version
+        rnt_write(file, UInt32(fEND); legacy=true)     # first free byte
+        rnt_write(file, UInt32(_RNT_START_BIGFILE); legacy=true)
+    end
     @assert position(file) == fEND
-    fileheader_obs[:fEND] = UInt32(fEND)
 
-    flush!(fileheader_obs)
-    flush!(tdirectory32_obs)
+    if bigfile
+        h = fileheader_obs.object
+        seek(file, 4)
+        rnt_write(file, Int32(1000000) + _RNT_ROOT_VERSION; legacy=true)
+        @assert position(file) == fileheader_obs.position
+        rnt_write(file, UnROOT.FileHeader64(h.fBEGIN, fEND, fSeekFree, fNbytesFree, h.nfree,
+                                            h.fNbytesName, 0x08, h.fCompress,
+                                            fSeekInfo, fNbytesInfo, h.fUUID))
+        d = tdirectory_obs.object
+        seek(file, tdirectory_obs.position)
+        rnt_write(file, UnROOT.ROOTDirectoryHeader64(d.fVersion + 1000, d.fDatimeC, d.fDatimeM,
+                                                     fNbytesKeys, d.fNbytesName, d.fSeekDir,
+                                                     d.fSeekParent, fSeekKeys))
+        rnt_write(file, Stubs.dummy_padding2[1:18])  # TUUID
+        seek(file, fEND)
+    else
+        fileheader_obs[:fEND] = UInt32(fEND)
+        fileheader_obs[:fSeekFree] = UInt32(fSeekFree)
+        fileheader_obs[:fNbytesFree] = fNbytesFree
+        fileheader_obs[:fSeekInfo] = UInt32(fSeekInfo)
+        fileheader_obs[:fNbytesInfo] = fNbytesInfo
+        tdirectory_obs[:fNbytesKeys] = fNbytesKeys
+        tdirectory_obs[:fSeekKeys] = Int32(fSeekKeys)
+        flush!(fileheader_obs)
+        flush!(tdirectory_obs)
+    end
+    return nothing
+end
+
+"""
+    write_rntuple(file::IO, table; file_name="test_ntuple_minimal.root",
+                  rntuple_name="myntuple", compression=$(100 * 4 + 4), kwargs...)
+
+Write `table` (any Tables.jl-compatible table, e.g. a `NamedTuple` of vectors)
+into `file` as an RNTuple inside a freshly created ROOT file structure. The
+output is readable by UnROOT itself, uproot, and ROOT (≥ 6.34).
+
+Supported column element types: `Bool` (bit column), `Int8`–`Int64`,
+`UInt8`–`UInt64`, `Float16`/`Float32`/`Float64`, `String`, and (nested)
+`Vector`s of these.
+
+`compression` is a ROOT `fCompress` code (`algorithm*100 + level`); pass `0` for
+no compression. Supported algorithms: `4` LZ4 (default, level 4), `1` ZLIB,
+`5` ZSTD. Each page and the header/footer/page-list envelopes are compressed
+independently, and any block that fails to shrink is stored uncompressed.
+
+This is a one-shot wrapper around [`RNTupleWriter`](@ref). By default the table is
+written as a single cluster with one page per column, as by the earlier one-shot writer;
+`page_size` and `cluster_size` cut it into pages and clusters like the `RNTupleWriter`.
+To write a table that does not fit in memory, use an `RNTupleWriter` directly and append
+it batch by batch.
+
+Current limitations: struct/union columns are not supported.
+
+# Example
+```julia
+julia> open("out.root", "w") do io
+           UnROOT.write_rntuple(io, (x=[1.0, 2.0], s=["a", "b"]); rntuple_name="t")
+       end
+
+julia> LazyTree("out.root", "t")
+```
+"""
+function write_rntuple(file::IO, table; file_name="test_ntuple_minimal.root",
+                       rntuple_name="myntuple", compression::Integer=RNT_DEFAULT_COMPRESSION,
+                       page_size::Integer=typemax(Int), cluster_size::Integer=typemax(Int))
+    if !istable(table)
+        error("RNTuple writing accepts object compatible with Tables.jl interface, got type $(typeof(table))")
+    end
+    RNTupleWriter(file, table; file_name, rntuple_name, compression, page_size, cluster_size) do writer
+        append!(writer, table)
+    end
+    return nothing
 end
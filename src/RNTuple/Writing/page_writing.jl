@@ -19,6 +19,21 @@ function rnt_col_to_ary(col::AbstractVector{<:AbstractString})
     rnt_col_to_ary(codeunits.(col))
 end
 
+"""
+    _rnt_column_eltypes(T) -> Vector{Any}
+
+Element types of the arrays [`rnt_col_to_ary`](@ref) produces for a user-facing column
+with element type `T`: the (0-based) offsets of strings and vectors are `Int64`.
+"""
+_rnt_column_eltypes(T::Type{<:Real}) = Any[T]
+_rnt_column_eltypes(::Type{<:AbstractString}) = Any[Int64, UInt8]
+_rnt_column_eltypes(T::Type{<:AbstractVector}) = Any[Int64; _rnt_column_eltypes(eltype(T))]
+
+# bytes a column occupies once flattened by `rnt_col_to_ary`, without flattening it
+_rnt_nbytes(col::AbstractVector{<:Real}) = sizeof(eltype(col)) * length(col)
+_rnt_nbytes(col::AbstractVector{<:AbstractString}) = 8 * length(col) + sum(ncodeunits, col; init=0)
+_rnt_nbytes(col::AbstractVector{<:AbstractVector}) = 8 * length(col) + sum(_rnt_nbytes, col; init=0)
+
 """
     rnt_ary_to_page(ary::AbstractVector, cr::ColumnRecord) end
 
@@ -48,7 +48,10 @@ function _read_locator(io, locator, uncomp_size::Integer)
 end
 
 function _read_locator!(dst::Vector{UInt8}, io, locator, uncomp_size::Integer)
-    decompress_bytes!(dst, read_seek_nb(io, locator.offset, locator.num_bytes), uncomp_size)
+    t0 = _tic()
+    bytes = read_seek_nb(io, locator.offset, locator.num_bytes)
+    _toc!(t0, :read, locator.num_bytes)
+    decompress_bytes!(dst, bytes, uncomp_size)
 end
 
 const _envlink_cache = LRU{Tuple{Any,EnvLink},Vector{UInt8}}(maxsize = 200)
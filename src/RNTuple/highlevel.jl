@@ -16,14 +16,16 @@ struct RNTupleField{R, F, O, E} <: AbstractVector{E}
     buffers::Vector{O}
     thread_locks::Vector{ReentrantLock}
     buffer_ranges::Vector{UnitRange{Int64}}
-    function RNTupleField(rn::R, field::F) where {R, F}
+    # top-level field name, the key of the `IOProfile` counters (after the path of the RNTuple)
+    name::String
+    function RNTupleField(rn::R, field::F, name::AbstractString="") where {R, F}
         O = _field_output_type(F)
         E = eltype(O)
         Nthreads = _maxthreadid()
         buffers = Vector{O}(undef, Nthreads)
         thread_locks = [ReentrantLock() for _ in 1:Nthreads]
         buffer_ranges = [0:-1 for _ in 1:Nthreads]
-        new{R, F, O, E}(rn, field, buffers, thread_locks, buffer_ranges)
+        new{R, F, O, E}(rn, field, buffers, thread_locks, buffer_ranges, name)
     end
 end
 Base.length(rf::RNTupleField) = _length(rf.rn)
@@ -129,7 +131,7 @@ function _localindex_newcluster!(rf::RNTupleField, idx::Int, tid::Int)
         if first_entry + n_entries >= idx
             br = first_entry+1:(first_entry+n_entries)
             cluster_info = ClusterInfo(nested_page_locations[cluster_idx], first_entry, n_entries)
-            @inbounds rf.buffers[tid] = read_field(rf.rn.io, rf.field, cluster_info)
+            @inbounds rf.buffers[tid] = _cached_read_field(rf, cluster_idx, cluster_info)
             @inbounds rf.buffer_ranges[tid] = br
             return idx - br.start + 1
         end
@@ -137,6 +139,21 @@ function _localindex_newcluster!(rf::RNTupleField, idx::Int, tid::Int)
     error("$idx-th event not found in cluster summaries")
 end
 
+function _cached_read_field(rf::RNTupleField, cluster_idx, cluster_info)
+    (; profile) = rf.rn
+    cache = rf.rn.basketcache
+    isnothing(cache) && return _profiled(() -> read_field(rf.rn.io, rf.field, cluster_info), profile, rf)
+    # the header seek tells apart RNTuples of the same file with identical schemas
+    key = (rf.rn.anchor.fSeekHeader, rf.field, cluster_idx)
+    miss = Ref(false)
+    res = get!(cache, key) do
+        miss[] = true
+        _profiled(() -> read_field(rf.rn.io, rf.field, cluster_info), profile, rf)
+    end
+    isnothing(profile) || _record!(profile, _profilename(profile, rf), miss[] ? :miss : :hit, 0, 0)
+    return res
+end
+
 """
     RNTuple
 
@@ -187,7 +204,10 @@ struct RNTuple{O}
     # per-thread lock, so the shared page-list cache needs its own
     pagelinks_lock::ReentrantLock
     schema::RNTupleSchema
-    function RNTuple(io::O, anchor, header, footer, schema) where {O}
+    # the `BasketCache` and `IOProfile` of the parent `ROOTFile`, if any
+    basketcache::Union{Nothing, BasketCache}
+    profile::Union{Nothing, IOProfile}
+    function RNTuple(io::O, anchor, header, footer, schema, basketcache=nothing, profile=nothing) where {O}
         new{O}(
             io,
             anchor,
@@ -196,10 +216,19 @@ struct RNTuple{O}
             Dict{Int, PageLink}(),
             ReentrantLock(),
             RNTupleSchema(schema),
+            basketcache,
+            profile,
         )
     end
 end
 
+# RNTuples are told apart by their header: `LazyTree` makes new `RNTuple`s of the selected fields
+_profilepath!(p::IOProfile, rn::RNTuple, path) = _setprofilepath!(p, rn.anchor.fSeekHeader, path)
+function _profilename(p::IOProfile, rf::RNTupleField)
+    path = Base.@lock p.lock get(p.paths, rf.rn.anchor.fSeekHeader, nothing)
+    return isnothing(path) ? rf.name : "$path/$(rf.name)"
+end
+
 function _length(rn::RNTuple)::Int
     last_record_idx = lastindex(rn.footer.cluster_group_records)
     page_list = _read_page_list(rn, last_record_idx)
@@ -228,8 +257,8 @@ function LazyTree(rn::RNTuple, selection)
 
     N = Tuple(Symbol.(filtered_names))
     skim_schema = getfield(rn.schema, :namedtuple)[N]
-    new_rn =  RNTuple(rn.io, rn.anchor, rn.header, rn.footer, skim_schema)
-    T = Tuple(RNTupleField(new_rn, getproperty(new_rn.schema, k)) for k in N)
+    new_rn =  RNTuple(rn.io, rn.anchor, rn.header, rn.footer, skim_schema, rn.basketcache, rn.profile)
+    T = Tuple(RNTupleField(new_rn, getproperty(new_rn.schema, k), String(k)) for k in N)
 
     return LazyTree(NamedTuple{N}(T))
 end
@@ -19,6 +19,7 @@ using LibDeflate: zlib_decompress!, zlib_compress!, Decompressor, Compressor, cr
 using BitIntegers: @define_integers
 
 import Tables, PrettyTables
+import Serialization
 
 if VERSION < v"1.9"
   using TOML
@@ -42,13 +43,17 @@ Base.position(io::OffsetBuffer) = position(io.io) + io.offset
 
 include("constants.jl")
 include("streamsource.jl")
+include("profiling.jl")
 include("io.jl")
 include("types.jl")
 include("utils.jl")
 include("streamers.jl")
 include("bootstrap.jl")
 include("roofit.jl")
+include("basketcache.jl")
 include("root.jl")
+include("sidecar.jl")
+include("prefetch.jl")
 include("iteration.jl")
 include("custom.jl")
 include("displays.jl")
@@ -66,9 +71,12 @@ include("RNTuple/highlevel.jl")
 include("RNTuple/fieldcolumn_reading.jl")
 include("RNTuple/displays.jl")
 
+include("selection.jl")
+
 include("RNTuple/Writing/page_writing.jl")
 include("RNTuple/Writing/compression.jl")
 include("RNTuple/Writing/TFileWriter.jl")
+include("RNTuple/Writing/cluster_writing.jl")
 include("RNTuple/Writing/Stubs.jl")
 
 _maxthreadid() = @static if VERSION < v"1.9"
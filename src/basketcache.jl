@@ -0,0 +1,74 @@
+# default byte budget of the decompressed-basket cache of a `ROOTFile`: opt-in, so that
+# opening a file does not silently keep hundreds of MiB of baskets alive
+const DEFAULT_BASKETCACHE_SIZE = 0
+
+"""
+    BasketCache
+
+Size-bounded LRU cache of decompressed and interpreted baskets (TTree) and cluster-worth of
+fields (RNTuple), shared by all [`LazyBranch`](@ref)es, [`RNTupleField`](@ref)s and threads
+reading from the same [`ROOTFile`](@ref). It has its own lock, which is only held for the
+lookup/insertion itself: reading and decompressing happens outside of it, so two threads
+missing on the same key at the same time may both decompress it.
+
+The size of the cached items is measured with `Base.summarysize` and their sum is kept
+below `maxsize` bytes; a cache with `maxsize == 0` is disabled, which is the default of
+[`ROOTFile`](@ref). Use [`cache_info`](@ref) for the hit/miss/eviction counters.
+
+!!! note
+    Cached arrays are shared, they must not be mutated.
+"""
+struct BasketCache
+    lru::LRU{Any, Any}
+    hits::Threads.Atomic{Int}
+    misses::Threads.Atomic{Int}
+    # items inserted and items dropped by `empty!`: whatever else left the LRU was evicted
+    # to make room, which the LRU finalizer can not tell apart (it also runs on deletion)
+    inserted::Threads.Atomic{Int}
+    cleared::Threads.Atomic{Int}
+end
+
+function BasketCache(maxsize::Integer=DEFAULT_BASKETCACHE_SIZE)
+    lru = LRU{Any, Any}(; maxsize, by=Base.summarysize)
+    return BasketCache(lru, (Threads.Atomic{Int}(0) for _ in 1:4)...)
+end
+
+function Base.get!(f::Function, c::BasketCache, key)
+    iszero(c.lru.maxsize) && return f()
+    computed = nothing
+    # when two threads miss on the same key, the LRU keeps the first value and never
+    # overwrites it, the second one is simply dropped
+    val = get!(c.lru, key) do
+        computed = f()
+    end
+    Threads.atomic_add!(isnothing(computed) ? c.hits : c.misses, 1)
+    val === computed && Threads.atomic_add!(c.inserted, 1)
+    return val
+end
+
+Base.haskey(c::BasketCache, key) = haskey(c.lru, key)
+
+function Base.empty!(c::BasketCache)
+    Threads.atomic_add!(c.cleared, length(c.lru))
+    empty!(c.lru)
+    return c
+end
+
+"""
+    cache_info(c::BasketCache)
+    cache_info(f::ROOTFile)
+
+Return the `hits`, `misses` and `evictions` counters together with the current `size` and
+the `maxsize` (both in bytes) of a [`BasketCache`](@ref) as a `NamedTuple`.
+"""
+function cache_info(c::BasketCache)
+    evictions = max(c.inserted[] - c.cleared[] - length(c.lru), 0)
+    return (; hits=c.hits[], misses=c.misses[], evictions,
+            size=c.lru.currentsize, maxsize=c.lru.maxsize)
+end
+
+function Base.show(io::IO, c::BasketCache)
+    (; hits, misses, evictions, size, maxsize) = cache_info(c)
+    print(io, "BasketCache($(size) of $(maxsize) bytes used, ",
+          "$hits hits, $misses misses, $evictions evictions)")
+end
@@ -35,14 +35,20 @@ function array(f::ROOTFile, branch; raw=false)
         "Branches with multiple leaves are not supported yet. Try reading with `array(...; raw=true)`.",
     )
 
-    rawdata, rawoffsets = readbranchraw(f, branch)
-    if raw
-        return rawdata, rawoffsets
-    end
+    raw && return readbranchraw(f, branch)
     T, J = auto_T_JaggT(f, branch; customstructs=f.customstructs)
-    return interped_data(rawdata, rawoffsets, T, J)
+    if _hasmmappath(f.fobj, T, J)
+        # the same baskets as `readbranchraw`, decoded straight from the mmap (and
+        # profiled per basket)
+        return _basketarray_mmap(f, branch, _storedbaskets(branch), T, J)
+    end
+    rawdata, rawoffsets = readbranchraw(f, branch)
+    return _profiled(() -> interped_data(rawdata, rawoffsets, T, J), f.profile, branch)
 end
 
+# the baskets written to the file (as opposed to the recovered one), up to the first unused slot
+_storedbaskets(branch) = 1:something(findfirst(iszero, branch.fBasketSeek), length(branch.fBasketSeek) + 1) - 1
+
 """
     basketarray(f::ROOTFile, path::AbstractString, ith)
     basketarray(f::ROOTFile, branch::Union{TBranch, TBranchElement}, ith)
@@ -74,31 +80,60 @@ function rawbasketarray(f::ROOTFile, branch, ithbasket::Integer)
 end
 
 function basketarray(f::ROOTFile, branch, ithbasket::AbstractVector{<:Integer})
-    tuples = [rawbasketarray(f, branch, i) for i in ithbasket]
-    rawdata = reduce(vcat, first.(tuples))
-    # Each basket's offsets are relative to the start of its own data (first
-    # offset 0, last offset == content size), so when concatenating baskets we
-    # must shift every subsequent basket's offsets by the accumulated data size
-    # (same re-basing as `readbranchraw`).
-    if all(t -> isempty(t[2]), tuples)
-        rawoffsets = Int32[]
-    else
-        rawoffsets = Int32[0]
-        position = Int32(0)
-        for (data, offsets) in tuples
-            append!(rawoffsets, (@view offsets[2:end]) .+ position)
-            position += Int32(length(data))
+    T, J = auto_T_JaggT(f, branch; customstructs=f.customstructs)
+    if length(branch.fLeaves.elements) == 1 && _hasmmappath(f.fobj, T, J) && all(!=(-1), ithbasket)
+        return _basketarray_mmap(f, branch, ithbasket, T, J)
+    end
+    return _profiled(f.profile, branch) do
+        tuples = [rawbasketarray(f, branch, i) for i in ithbasket]
+        rawdata = reduce(vcat, first.(tuples))
+        # Each basket's offsets are relative to the start of its own data (first
+        # offset 0, last offset == content size), so when concatenating baskets we
+        # must shift every subsequent basket's offsets by the accumulated data size
+        # (same re-basing as `readbranchraw`).
+        if all(t -> isempty(t[2]), tuples)
+            rawoffsets = Int32[]
+        else
+            rawoffsets = Int32[0]
+            position = Int32(0)
+            for (data, offsets) in tuples
+                append!(rawoffsets, (@view offsets[2:end]) .+ position)
+                position += Int32(length(data))
+            end
         end
+        return interped_data(rawdata, rawoffsets, T, J)
     end
-    T, J = auto_T_JaggT(f, branch; customstructs=f.customstructs)
-    return interped_data(rawdata, rawoffsets, T, J)
 end
 
 
 function basketarray(f::ROOTFile, branch, ithbasket::Integer)
-    rawdata, rawoffsets = rawbasketarray(f, branch, ithbasket)
-    T, J = auto_T_JaggT(f, branch; customstructs=f.customstructs)
-    return interped_data(rawdata, rawoffsets, T, J)
+    return _profiled(f.profile, branch) do
+        T, J = auto_T_JaggT(f, branch; customstructs=f.customstructs)
+        if ithbasket != -1 && length(branch.fLeaves.elements) == 1 && _hasmmappath(f.fobj, T, J)
+            return _basketarray_mmap(f, branch, ithbasket, T, J)
+        end
+        rawdata, rawoffsets = rawbasketarray(f, branch, ithbasket)
+        return interped_data(rawdata, rawoffsets, T, J)
+    end
+end
+
+# `basketarray` going through the file's `BasketCache`; the seek position
+# identifies a basket within the file
+function _cached_basketarray(f::ROOTFile, branch, ithbasket::Integer)
+    isnothing(f.profile) || return _cached_basketarray_profiled(f, branch, ithbasket)
+    return get!(f.basketcache, branch.fBasketSeek[ithbasket]) do
+        basketarray(f, branch, ithbasket)
+    end
+end
+
+function _cached_basketarray_profiled(f::ROOTFile, branch, ithbasket::Integer)
+    miss = Ref(false)
+    res = get!(f.basketcache, branch.fBasketSeek[ithbasket]) do
+        miss[] = true
+        basketarray(f, branch, ithbasket)
+    end
+    _record!(f.profile, _profilename(f.profile, branch), miss[] ? :miss : :hit, 0, 0)
+    return res
 end
 
 """
@@ -149,6 +184,9 @@ mutable struct LazyBranch{T,J,B} <: AbstractVector{T}
     buffer::Vector{B}
     thread_locks::Vector{ReentrantLock}
     buffer_range::Vector{UnitRange{Int64}}
+    # opt-in read-ahead shared with the other branches of a `LazyTree`, see `enable_prefetch!`
+    prefetcher::Union{Nothing, BasketPrefetcher}
+    prefetch_slot::Int
 
     function LazyBranch(f::ROOTFile, b::Union{TBranch,TBranchElement})
         T, J = auto_T_JaggT(f, b; customstructs=f.customstructs)
@@ -165,7 +203,8 @@ mutable struct LazyBranch{T,J,B} <: AbstractVector{T}
                                         b.fBasketEntry,
                                         [_buffer for _ in 1:Nthreads],
                                         [ReentrantLock() for _ in 1:Nthreads],
-                                        [0:-1 for _ in 1:Nthreads])
+                                        [0:-1 for _ in 1:Nthreads],
+                                        nothing, 0)
     end
 end
 LazyBranch(f::ROOTFile, s::AbstractString) = LazyBranch(f, f[s])
@@ -233,10 +272,19 @@ end
 
 @inbounds function _get_buffer_range(ba::LazyBranch{T, J, B}, tid::Integer, seek_idx::Integer) where {T,J,B}
     seek_idx -= 1
-    ba.buffer[tid] = basketarray(ba.f, ba.b, seek_idx)
+    ba.buffer[tid] = _sharedbasketarray(ba, seek_idx, tid)
     (ba.fEntry[seek_idx] + 1)::Int:(ba.fEntry[seek_idx + 1])::Int
 end
 
+# a basket through the read-ahead or the file's `BasketCache`, whichever the branch uses
+function _sharedbasketarray(ba::LazyBranch, ithbasket::Integer, tid::Integer=Threads.threadid())
+    isnothing(ba.prefetcher) && return _cached_basketarray(ba.f, ba.b, ithbasket)
+    return _prefetched_basketarray(ba.prefetcher, ba.prefetch_slot, ithbasket, tid)
+end
+
+# whether other readers may hold (or fetch) the baskets of `ba` for us
+_sharesbaskets(ba::LazyBranch) = !isnothing(ba.prefetcher) || !iszero(ba.f.basketcache.lru.maxsize)
+
 function _get_buffer_range(ba::LazyBranch{T, J, B}, tid::Integer, ::Nothing) where {T,J,B}
     ba.buffer[tid] = basketarray(ba.f, ba.b, -1)  # -1 indicating recovered basket mechanics
     # FIXME: this range is probably wrong for jagged data with non-empty offsets
@@ -494,7 +542,7 @@ function normalize_branchname(s::AbstractString)
 end
 
 """
-    function LazyTree(f::ROOTFile, tree::TTree, treepath, branches; sink = LazyTree)
+    function LazyTree(f::ROOTFile, tree::TTree, treepath, branches; sink = LazyTree, prefetch = 0, prefetch_budget = 512*1024^2, prefetch_gap = DEFAULT_READ_GAP)
 
 Creates a lazy tree object of the selected branches only. `branches` is vector
 of `String`, `Regex` or `Pair{Regex, SubstitutionString}`, where the first item
@@ -503,8 +551,14 @@ container can be used by providing a sink function. The sink function must take
 argument an table with a Tables.jl interface. The table columns are filled with 
 LazyBranch objects.
 
+With `prefetch = N > 0`, the baskets of the next `N` clusters of all selected branches
+are read and decompressed in background tasks while iterating, with at most
+`prefetch_budget` bytes of (estimated) decompressed data in flight, see
+[`BasketPrefetcher`](@ref). The baskets of a cluster are fetched with one coalesced read,
+merging byte ranges that are less than `prefetch_gap` bytes apart.
+
 """
-function LazyTree(f::ROOTFile, tree::TTree, treepath, branches; sink = LazyTree)
+function LazyTree(f::ROOTFile, tree::TTree, treepath, branches; sink = LazyTree, prefetch = 0, prefetch_budget = 512*1024^2, prefetch_gap = DEFAULT_READ_GAP)
     d = Dict{Symbol,LazyBranch}()
     _m(r::Regex) = Base.Fix1(occursin, r)
     all_bnames = getbranchnamesrecursive(tree)
@@ -532,6 +586,7 @@ function LazyTree(f::ROOTFile, tree::TTree, treepath, branches; sink = LazyTree)
     for (b, norm_name) in res_bnames
         d[Symbol(norm_name)] = LazyBranch(f, "$treepath/$b")
     end
+    prefetch > 0 && enable_prefetch!(collect(values(d)), prefetch; budget = prefetch_budget, gap = prefetch_gap)
 
     if sink == LazyTree
 	return LazyTree(NamedTuple{Tuple(keys(d))}(values(d)))
@@ -568,7 +623,17 @@ function Base.getindex(ba::LazyBranch{T,J,B}, range::UnitRange) where {T,J,B}
         iths = ib1-1:ib2-1
     end
     range = (first(range)-offset):(last(range)-offset)
-    return basketarray(ba, iths)[range]
+    # nothing to share: decode all baskets at once (straight from the mmap if possible)
+    _sharesbaskets(ba) || return basketarray(ba, iths)[range]
+    # otherwise one basket at a time, through the cache or the read-ahead
+    parts = [ith == -1 ? basketarray(ba, -1) : _sharedbasketarray(ba, ith) for ith in iths]
+    out = parts[1][first(range):min(last(range), length(parts[1]))]
+    pos = length(parts[1])
+    for part in @view parts[2:end]
+        append!(out, @view part[1:min(last(range) - pos, length(part))])
+        pos += length(part)
+    end
+    return out
 end
 
 _clusterranges(t::LazyTree) = _clusterranges([getproperty(t,p) for p in propertynames(t)])
@@ -0,0 +1,203 @@
+"""
+    BasketPrefetcher
+
+Read-ahead state shared by the [`LazyBranch`](@ref)es of one [`LazyTree`](@ref), see the
+`prefetch` keyword of [`LazyTree`](@ref). Every time one of the branches crosses a basket
+boundary, the baskets of the next `depth` clusters (cluster boundaries as computed by
+`_clusterranges`) of the registered branches are read, decompressed and interpreted in
+background tasks. The estimated uncompressed size of all pending baskets is kept below
+`budget` bytes. The baskets of one cluster are fetched with a single coalesced read plan
+(ranges closer than `gap` bytes are merged, see [`fetchbaskets`](@ref)), and the resulting
+round trips and over-read bytes are accumulated in `stats`.
+
+The read-ahead follows one read position per branch and thread (a "stream"), so threads
+iterating over different parts of the tree don't disturb each other's read-ahead. Only the
+branches a thread has read so far are read ahead for it, so reading a single column (or a
+few columns of a wide tree) doesn't decode the others. Baskets a stream scheduled but left
+behind (before its current basket or cluster) are dropped; a random access or a backwards
+jump simply restarts the stream at the new position. Closing the file waits for the read-ahead in
+flight.
+"""
+mutable struct BasketPrefetcher
+    f::ROOTFile
+    branches::Vector{Union{TBranch, TBranchElement}}
+    clusters::Vector{UnitRange{Int64}}
+    depth::Int
+    budget::Int
+    # (branch slot, basket index) => (task, estimated uncompressed bytes, stream which scheduled it)
+    pending::Dict{Tuple{Int, Int}, Tuple{Task, Int, Int}}
+    pending_bytes::Int
+    # (branch slot, stream) => basket index last handed out to that stream
+    positions::Dict{Tuple{Int, Int}, Int}
+    lock::ReentrantLock
+    # the baskets of one cluster are fetched with a single coalesced read plan
+    gap::Int
+    stats::ReadStats
+end
+
+function BasketPrefetcher(f::ROOTFile, branches, clusters, depth, budget; gap=DEFAULT_READ_GAP)
+    p = BasketPrefetcher(f, branches, clusters, depth, budget,
+                         Dict{Tuple{Int, Int}, Tuple{Task, Int, Int}}(), 0,
+                         Dict{Tuple{Int, Int}, Int}(), ReentrantLock(),
+                         gap, ReadStats())
+    # so that `close(f)` can wait for the read-ahead in flight
+    f.prefetchers[p] = nothing
+    return p
+end
+
+# the uncompressed size of a basket is only known after reading its key, so
+# scale the on-disk size by the branch-wide compression factor instead
+function _estimated_basketbytes(b, ithbasket)
+    finflate = b.fZipBytes > 0 ? b.fTotBytes / b.fZipBytes : 1.0
+    return ceil(Int, b.fBasketBytes[ithbasket] * finflate)
+end
+
+"""
+    _prefetched_basketarray(p::BasketPrefetcher, slot, ithbasket, stream=Threads.threadid())
+
+Drop-in replacement of [`basketarray`](@ref) for the branch registered at `slot`: returns the
+prefetched basket if there is one (waiting for its task if it is still in flight) and
+schedules the read-ahead of the clusters following `ithbasket` for `stream`.
+"""
+function _prefetched_basketarray(p::BasketPrefetcher, slot::Integer, ithbasket::Integer, stream::Integer=Threads.threadid())
+    task = Base.@lock p.lock begin
+        # a jump (backwards or forwards) just moves the stream, the read-ahead restarts from here
+        p.positions[(slot, stream)] = ithbasket
+        entry = pop!(p.pending, (slot, ithbasket), nothing)
+        isnothing(entry) || (p.pending_bytes -= entry[2])
+        _drop_stale!(p, slot, ithbasket, stream, _clusterof(p, slot, ithbasket))
+        _schedule_prefetch!(p, slot, ithbasket, stream)
+        isnothing(entry) ? nothing : first(entry)
+    end
+    isnothing(task) && return _cached_basketarray(p.f, p.branches[slot], ithbasket)
+    return get!(p.f.basketcache, p.branches[slot].fBasketSeek[ithbasket]) do
+        fetch(task)
+    end
+end
+
+# index of the cluster holding the first entry of basket `ithbasket` of `slot`
+_clusterof(p::BasketPrefetcher, slot, ithbasket) =
+    searchsortedlast(p.clusters, p.branches[slot].fBasketEntry[ithbasket] + 1; by=first)
+
+# drop the baskets `stream` scheduled but left behind: those of `slot` before `ithbasket`,
+# and those of any branch ending before the current cluster; the ones other streams
+# scheduled may still be needed
+function _drop_stale!(p::BasketPrefetcher, slot, ithbasket, stream, icluster)
+    start = icluster < 1 ? 0 : first(p.clusters[icluster])
+    for (key, (_, nbytes, owner)) in collect(p.pending)
+        owner == stream || continue
+        s, j = key
+        if (s == slot && j < ithbasket) || p.branches[s].fBasketEntry[j+1] < start
+            delete!(p.pending, key)
+            p.pending_bytes -= nbytes
+        end
+    end
+    return p
+end
+
+function _schedule_prefetch!(p::BasketPrefetcher, slot, ithbasket, stream)
+    icluster = _clusterof(p, slot, ithbasket)
+    # only the branches this stream actually reads
+    slots = [s for s in eachindex(p.branches) if haskey(p.positions, (s, stream))]
+    for r in @view p.clusters[icluster+1:min(icluster + p.depth, end)]
+        keys = Tuple{Int, Int}[]
+        sizes = Int[]
+        full = false
+        for s in slots
+            branch = p.branches[s]
+            for j in _basketsin(branch, r)
+                # baskets this stream already read
+                j <= get(p.positions, (s, stream), 0) && continue
+                (haskey(p.pending, (s, j)) || branch.fBasketSeek[j] == 0) && continue
+                haskey(p.f.basketcache, branch.fBasketSeek[j]) && continue
+                nbytes = _estimated_basketbytes(branch, j)
+                # always keep at least one basket in flight, even with a tiny budget
+                full = (!isempty(p.pending) || !isempty(keys)) && p.pending_bytes + nbytes > p.budget
+                full && break
+                push!(keys, (s, j))
+                push!(sizes, nbytes)
+                p.pending_bytes += nbytes
+            end
+            full && break
+        end
+        _spawn_prefetch!(p, keys, sizes, stream)
+        full && break
+    end
+    return p
+end
+
+# one coalesced read for all baskets of a cluster, then decompress and interpret
+# every basket in its own task
+function _spawn_prefetch!(p::BasketPrefetcher, keys, sizes, stream)
+    isempty(keys) && return p
+    (; f, branches, gap, stats) = p
+    if f.fobj isa MmapStream
+        # nothing to coalesce for a local file, and `basketarray` decodes straight from the mmap
+        for ((s, j), nbytes) in zip(keys, sizes)
+            branch = branches[s]
+            p.pending[(s, j)] = (Threads.@spawn(basketarray(f, branch, j)), nbytes, stream)
+        end
+        return p
+    end
+    bytes = Threads.@spawn _profiled_fetchbaskets(f, branches, keys; gap, stats)
+    for (key, nbytes) in zip(keys, sizes)
+        branch = branches[first(key)]
+        ithbasket = last(key)
+        task = Threads.@spawn begin
+            basketbytes = fetch(bytes)[key]
+            _profiled(f.profile, branch) do
+                rawdata, rawoffsets = readbasketbytes(branch, basketbytes, branch.fBasketSeek[ithbasket])
+                T, J = auto_T_JaggT(f, branch; customstructs=f.customstructs)
+                interped_data(rawdata, rawoffsets, T, J)
+            end
+        end
+        p.pending[key] = (task, nbytes, stream)
+    end
+    return p
+end
+
+# `fetchbaskets`, sharing the time of the coalesced read among the baskets by size
+function _profiled_fetchbaskets(f::ROOTFile, branches, keys; kwargs...)
+    isnothing(f.profile) && return fetchbaskets(f, branches, keys; kwargs...)
+    t0 = time_ns()
+    chunks = fetchbaskets(f, branches, keys; kwargs...)
+    ns = time_ns() - t0
+    total = max(sum(length, values(chunks); init=0), 1)
+    for ((s, _), basketbytes) in chunks
+        _record!(f.profile, _profilename(f.profile, branches[s]), :read, round(Int, ns * length(basketbytes) / total), length(basketbytes))
+    end
+    return chunks
+end
+
+# wait for the read-ahead in flight and drop it, tasks can not be interrupted
+function _finish!(p::BasketPrefetcher)
+    tasks = Base.@lock p.lock begin
+        ts = [first(entry) for entry in values(p.pending)]
+        empty!(p.pending)
+        p.pending_bytes = 0
+        ts
+    end
+    for task in tasks
+        # nobody is going to use the result (or the error) anymore
+        try wait(task) catch end
+    end
+    return p
+end
+
+"""
+    enable_prefetch!(lbs::AbstractVector{<:LazyBranch}, depth; budget=512*1024^2, gap=DEFAULT_READ_GAP)
+
+Attach a shared [`BasketPrefetcher`](@ref) to the given branches (which must come from the same
+file and tree) so that iterating over them reads `depth` clusters ahead, keeping at most
+`budget` bytes of decompressed baskets in flight.
+"""
+function enable_prefetch!(lbs::AbstractVector, depth::Integer; budget::Integer=512*1024^2, gap::Integer=DEFAULT_READ_GAP)
+    isempty(lbs) && return lbs
+    depth > 0 || throw(ArgumentError("prefetch depth must be positive, got $depth"))
+    p = BasketPrefetcher(first(lbs).f, Union{TBranch, TBranchElement}[lb.b for lb in lbs], _clusterranges(lbs), depth, budget; gap)
+    for (slot, lb) in enumerate(lbs)
+        lb.prefetcher = p
+        lb.prefetch_slot = slot
+    end
+    return lbs
+end
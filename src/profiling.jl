@@ -0,0 +1,183 @@
+"""
+    BranchIOStats
+
+Counters of one branch (TTree) or top-level field (RNTuple) in an [`IOProfile`](@ref):
+
+- `reads`: number of baskets (TTree) or pages (RNTuple) read from the source
+- `bytes_read`: on-disk bytes of these baskets and pages
+- `bytes_decompressed`: bytes produced by the decompressor (`0` for uncompressed data)
+- `ns_read`, `ns_decompress`, `ns_decode`: nanoseconds spent in each stage, decoding being
+  everything between the raw bytes and the final array (basket key parsing, byte swapping,
+  offsets, ...)
+- `cache_hits`, `cache_misses`: lookups in the file's [`BasketCache`](@ref)
+- `codecs`: compression algorithms seen, as the 2 character tag of the ROOT compression
+  block header (`"ZL"`, `"L4"`, `"XZ"`, `"ZS"`)
+"""
+mutable struct BranchIOStats
+    reads::Int
+    bytes_read::Int
+    bytes_decompressed::Int
+    ns_read::Int
+    ns_decompress::Int
+    ns_decode::Int
+    cache_hits::Int
+    cache_misses::Int
+    codecs::Vector{String}
+end
+BranchIOStats() = BranchIOStats(0, 0, 0, 0, 0, 0, 0, 0, String[])
+
+# number of active `IOProfile`s: while it is zero, the stage timers below reduce to a
+# single atomic load, so files opened without profiling pay nothing
+const _NPROFILES = Threads.Atomic{Int}(0)
+
+"""
+    IOProfile
+
+Opt-in per-branch I/O and decoding counters of a [`ROOTFile`](@ref) opened with
+`profile = true`, see [`io_profile`](@ref). Maps the path of the branch (or RNTuple field)
+in the file, e.g. `"Events/run"`, to its [`BranchIOStats`](@ref), so that same-named
+branches of different trees are kept apart; baskets read by several threads are accounted
+under the same lock. Branches which were not looked up by path (e.g. `tree["run"]`) are
+accounted under their bare name.
+
+`show` prints the counters as a table, sorted by total time, and the profile is a
+`Tables.jl` column table. `empty!` resets it.
+"""
+struct IOProfile
+    stats::Dict{String, BranchIOStats}
+    # branch => its path in the file, and header seek => path for RNTuples, see `_profilepath!`
+    paths::IdDict{Any, String}
+    lock::ReentrantLock
+    # unset once the file is closed, see `_close!`
+    active::Threads.Atomic{Bool}
+end
+
+function IOProfile()
+    Threads.atomic_add!(_NPROFILES, 1)
+    return IOProfile(Dict{String, BranchIOStats}(), IdDict{Any, String}(), ReentrantLock(), Threads.Atomic{Bool}(true))
+end
+
+# remember the path in the file of `key` (see `_setprofilepath!`), the first one wins
+_setprofilepath!(p::IOProfile, key, path::AbstractString) =
+    Base.@lock p.lock get!(p.paths, key, String(strip(path, '/')))
+
+# the key of the counters of `x`: a name as is, or the path of a branch (see `root.jl`)
+_profilename(::IOProfile, name::AbstractString) = String(name)
+
+function _close!(p::IOProfile)
+    Threads.atomic_xchg!(p.active, false) && Threads.atomic_sub!(_NPROFILES, 1)
+    return p
+end
+
+# the stats only, the paths stay valid
+Base.empty!(p::IOProfile) = (Base.@lock p.lock empty!(p.stats); p)
+
+function _record!(p::IOProfile, name::AbstractString, stage::Symbol, ns::Integer, nbytes::Integer, codecs=())
+    Base.@lock p.lock begin
+        s = get!(BranchIOStats, p.stats, name)
+        if stage === :read
+            s.reads += 1
+            s.bytes_read += nbytes
+            s.ns_read += ns
+        elseif stage === :decompress
+            s.bytes_decompressed += nbytes
+            s.ns_decompress += ns
+            for codec in codecs
+                codec in s.codecs || push!(s.codecs, codec)
+            end
+        elseif stage === :decode
+            s.ns_decode += ns
+        elseif stage === :hit
+            s.cache_hits += 1
+        elseif stage === :miss
+            s.cache_misses += 1
+        else
+            error("Unknown profiling stage $stage")
+        end
+    end
+    return nothing
+end
+
+# the basket or cluster currently being read by this task, the read and decompress
+# stages below it are attributed to `name`
+mutable struct _ProfileScope
+    profile::IOProfile
+    name::String
+    ns_stages::Int
+end
+
+_profilescope() = get(task_local_storage(), :UnROOT_profilescope, nothing)::Union{Nothing, _ProfileScope}
+
+"""
+    _profiled(f, profile, name)
+
+Run `f()`, which reads and decodes one basket (or cluster) of the branch `name` (a name or
+the branch itself, see `_profilename`), accounting the read and decompression stages inside
+of it (see `_tic`/`_toc!`) to `name` in `profile` and the rest of the time as decoding.
+Simply calls `f()` when `profile` is `nothing`.
+"""
+@inline function _profiled(f::F, profile::Union{Nothing, IOProfile}, name) where {F}
+    isnothing(profile) && return f()
+    return _profiled_scope(f, profile, _profilename(profile, name))
+end
+
+# `F` forces the specialization on `f`, which is only passed on, to keep this inferable
+@noinline function _profiled_scope(f::F, profile::IOProfile, name::String) where {F}
+    scope = _ProfileScope(profile, name, 0)
+    t0 = time_ns()
+    res = task_local_storage(f, :UnROOT_profilescope, scope)
+    _record!(profile, name, :decode, Int(time_ns() - t0) - scope.ns_stages, 0)
+    return res
+end
+
+# start of a read or decompression stage, `0` unless inside a `_profiled` scope
+@inline _tic() = iszero(_NPROFILES[]) ? UInt64(0) : _tic_scope()
+@noinline _tic_scope() = isnothing(_profilescope()) ? UInt64(0) : time_ns()
+
+@inline function _toc!(t0::UInt64, stage::Symbol, nbytes::Integer, codecs=())
+    iszero(t0) || _toc_scope!(t0, stage, nbytes, codecs)
+    return nothing
+end
+
+@noinline function _toc_scope!(t0, stage, nbytes, codecs)
+    ns = Int(time_ns() - t0)
+    scope = _profilescope()
+    isnothing(scope) && return nothing
+    scope.ns_stages += ns
+    # the codecs are passed as the raw compression block tags, only turned into strings here
+    _record!(scope.profile, scope.name, stage, ns, nbytes, (String(c) for c in codecs))
+end
+
+Tables.istable(::Type{IOProfile}) = true
+Tables.columnaccess(::Type{IOProfile}) = true
+function Tables.columns(p::IOProfile)
+    rows = Base.@lock p.lock sort!(collect(p.stats); by=((_, s),) -> s.ns_read + s.ns_decompress + s.ns_decode, rev=true)
+    col(f) = [f(s) for (_, s) in rows]
+    return (; name = first.(rows),
+            reads = col(s -> s.reads),
+            bytes_read = col(s -> s.bytes_read),
+            bytes_decompressed = col(s -> s.bytes_decompressed),
+            ms_read = col(s -> s.ns_read / 1e6),
+            ms_decompress = col(s -> s.ns_decompress / 1e6),
+            ms_decode = col(s -> s.ns_decode / 1e6),
+            cache_hits = col(s -> s.cache_hits),
+            cache_misses = col(s -> s.cache_misses),
+            codecs = col(s -> join(s.codecs, ",")))
+end
+
+function Base.show(io::IO, p::IOProfile)
+    n = Base.@lock p.lock length(p.stats)
+    print(io, "IOProfile($n branches)")
+end
+
+function Base.show(io::IO, ::MIME"text/plain", p::IOProfile)
+    println(io, p, ":")
+    PrettyTables.pretty_table(
+        io,
+        Tables.columns(p);
+        alignment=:r,
+        compact_printing=false,
+        formatters=[(v, i, j) -> v isa AbstractFloat ? round(v; digits=3) : v],
+    )
+    nothing
+end
@@ -15,15 +15,25 @@ struct ROOTFile
     header::FileHeader
     fobj::AbstractSourceStream
     tkey::TKey
-    streamers::Streamers
+    streamers::LazyStreamers
     directory::ROOTDirectory
     customstructs::Dict{String, Type}
     cache::Dict{Any, Any}
-    # protects `cache` and the stateful seek/read on `fobj` during object
-    # lookup, so that `f[path]` is safe to call from multiple threads
+    # serializes the parsing of objects (and the stateful seek/read on `fobj` it
+    # does), so that `f[path]` is safe to call from multiple threads
     lock::ReentrantLock
+    # only protects `cache`: lookups of parsed objects don't wait for `lock`
+    cachelock::ReentrantLock
+    # `BasketPrefetcher`s reading from this file, their read-ahead is waited for on `close`
+    prefetchers::WeakKeyDict{Any, Nothing}
+    # decompressed baskets shared by all branches and threads, has its own lock
+    basketcache::BasketCache
+    # per-branch I/O counters, only with `ROOTFile(...; profile = true)`
+    profile::Union{Nothing, IOProfile}
 end
 function close(f::ROOTFile)
+    foreach(_finish!, collect(keys(f.prefetchers)))
+    isnothing(f.profile) || _close!(f.profile)
     close(f.fobj)
 end
 function ROOTFile(f::Function, args...; pv...)
@@ -43,12 +53,25 @@ end
 
 const HEAD_BUFFER_SIZE = 2048
 """
-    ROOTFile(filename::AbstractString; customstructs = Dict("TLorentzVector" => LorentzVector{Float64}))
+    ROOTFile(filename::AbstractString; customstructs = Dict("TLorentzVector" => LorentzVector{Float64}), basketcache_size = 0, profile = false, metadata_index = nothing)
 
 `ROOTFile`'s constructor from a file. The `customstructs` dictionary can be used to pass user-defined
 struct as value and its corresponding `fClassName` (in Branch) as key such that `UnROOT` will know
 to interpret them, see [`interped_data`](@ref).
 
+With `basketcache_size > 0`, decompressed baskets are kept in a [`BasketCache`](@ref) of that
+many bytes which is shared by all lazy branches and threads reading this file. It is disabled
+by default.
+
+With `profile = true`, the bytes and time spent reading, decompressing and decoding the
+baskets (and RNTuple pages) are accounted per branch, see [`io_profile`](@ref). Without it,
+the instrumentation costs a single atomic load per basket.
+
+Opening a file only reads its header and top directory, the streamers and the trees are
+parsed on first use. Passing `metadata_index = true` (or the path of the index) loads the
+trees from a sidecar index written by [`write_metadata_index`](@ref) instead of parsing them,
+as long as the index matches the file. A missing or outdated index is ignored.
+
 See also: [`LazyTree`](@ref), [`LazyBranch`](@ref)
 
 # Example
@@ -65,7 +88,9 @@ test/samples/NanoAODv5_sample.root
    └─ "⋮"
 ```
 """
-function ROOTFile(filename::AbstractString; customstructs = Dict("TLorentzVector" => LorentzVector{Float64}))
+function ROOTFile(filename::AbstractString; customstructs = Dict("TLorentzVector" => LorentzVector{Float64}),
+                  basketcache_size::Integer = DEFAULT_BASKETCACHE_SIZE, profile::Bool = false,
+                  metadata_index::Union{Nothing, Bool, AbstractString} = nothing)
     fobj = if startswith(filename, r"https?://")
         httpstreamer(filename)
     elseif startswith(filename, "root://")
@@ -90,11 +115,8 @@ function ROOTFile(filename::AbstractString; customstructs = Dict("TLorentzVector
         unpack(head_buffer, FileHeader64)
     end
 
-    # Streamers (the record is exactly fNbytesInfo bytes; a fixed-size read
-    # would truncate large streamer records and over-read remote files)
-    seek(fobj, header.fSeekInfo)
-    stream_buffer = OffsetBuffer(IOBuffer(read(fobj, Int(header.fNbytesInfo))), Int(header.fSeekInfo))
-    streamers = Streamers(stream_buffer)
+    # only parsed when needed, see `LazyStreamers`
+    streamers = LazyStreamers(fobj, Int(header.fSeekInfo), Int(header.fNbytesInfo))
 
     seek(head_buffer, header.fBEGIN + header.fNbytesName)
     dir_header = unpack(head_buffer, ROOTDirectoryHeader)
@@ -113,7 +135,10 @@ function ROOTFile(filename::AbstractString; customstructs = Dict("TLorentzVector
 
     directory = ROOTDirectory(tkey.fName, dir_header, keys, fobj, streamers.refs)
 
-    ROOTFile(filename, format_version, header, fobj, tkey, streamers, directory, customstructs, Dict(), ReentrantLock())
+    f = ROOTFile(filename, format_version, header, fobj, tkey, streamers, directory, customstructs, Dict(), ReentrantLock(),
+                 ReentrantLock(), WeakKeyDict{Any, Nothing}(), BasketCache(basketcache_size), profile ? IOProfile() : nothing)
+    isnothing(metadata_index) || _load_metadata_index!(f, _metadata_index_path(f, metadata_index))
+    return f
 end
 
 function Base.show(io::IO, f::ROOTFile)
@@ -130,6 +155,29 @@ end
 
 UUID(f::ROOTFile) = f.header.fUUID
 
+cache_info(f::ROOTFile) = cache_info(f.basketcache)
+
+"""
+    io_profile(f::ROOTFile)
+
+The [`IOProfile`](@ref) of a file opened with `profile = true`, `nothing` otherwise. Displaying
+it prints the per-branch counters as a table:
+
+```julia
+julia> f = ROOTFile("test/samples/tree_with_large_array.root"; profile = true);
+
+julia> collect(LazyTree(f, "t1").int32_array);
+
+julia> UnROOT.io_profile(f)
+```
+"""
+io_profile(f::ROOTFile) = f.profile
+
+# branches (and RNTuples) are accounted under the path they were looked up by
+_profilepath!(::IOProfile, obj, path) = nothing
+_profilepath!(p::IOProfile, b::Union{TBranch, TBranchElement}, path) = _setprofilepath!(p, b, path)
+_profilename(p::IOProfile, b::Union{TBranch, TBranchElement}) = Base.@lock p.lock get(p.paths, b, b.fName)
+
 
 function streamerfor(f::ROOTFile, name::AbstractString)
     for e in f.streamers.elements
@@ -166,11 +214,18 @@ function streamerfor(f::ROOTFile, branch::TBranchElement)
 end
 
 
+const _NOTCACHED = gensym(:notcached)
 function Base.getindex(f::ROOTFile, s::AbstractString)
+    obj = Base.@lock f.cachelock get(f.cache, s, _NOTCACHED)
+    obj === _NOTCACHED || return obj
     Base.@lock f.lock begin
-        get!(f.cache, s) do
-            _getindex(f, s)
-        end
+        # another task may have parsed it while we were waiting for the lock
+        obj = Base.@lock f.cachelock get(f.cache, s, _NOTCACHED)
+        obj === _NOTCACHED || return obj
+        obj = _getindex(f, s)
+        isnothing(f.profile) || _profilepath!(f.profile, obj, s)
+        Base.@lock f.cachelock f.cache[s] = obj
+        return obj
     end
 end
 
@@ -195,6 +250,10 @@ function _getindex(f::ROOTFile, s)
             return tkey.fTitle
         end
         S = streamer(f.fobj, tkey, f.streamers.refs)
+        if S isa RNTuple
+            # let the fields share the decompressed clusters through the file's cache
+            return RNTuple(S.io, S.anchor, S.header, S.footer, getfield(S.schema, :namedtuple), f.basketcache, f.profile)
+        end
         return S
     end
 
@@ -292,6 +351,7 @@ function interped_data(rawdata, rawoffsets, ::Type{T}, ::Type{J}) where {T, J<:J
             jagg_offset = 10
         end
         subT = eltype(eltype(T))
+        _isswappable(subT) && return _unjaggjagg(subT, rawdata, rawoffsets, jagg_offset)
         out = VectorOfVectors(T(), Int32[1])
         @views for i in 1:(length(rawoffsets)-1)
             flat = rawdata[(rawoffsets[i]+1+jagg_offset:rawoffsets[i+1])]
@@ -312,6 +372,8 @@ function interped_data(rawdata, rawoffsets, ::Type{T}, ::Type{J}) where {T, J<:J
         # this is why we need to append `rawoffsets` in the `readbranchraw()` call
         # when you use this range to index `rawdata`, you will get raw bytes belong to each event
         # Say your real data is Int32 and you see 8 bytes after indexing, then this event has [num1, num2] as real data
+        J === Offsetjagg && _isswappable(eltype(T)) &&
+            return _unjagg(eltype(T), rawdata, rawoffsets, offsetof(Offsetjagg))
         _size = sizeof(eltype(T))
         if J === Offsetjagg
             jagg_offset = 10
@@ -569,7 +631,9 @@ function readbranchraw(f::ROOTFile, branch)
     position = 0
     for (seek, nb) in zip(branch.fBasketSeek, nbytes)
         seek==0 && break
-        data, offset = readbasketseek(f, branch, seek, nb)
+        data, offset = _profiled(f.profile, branch) do
+            readbasketseek(f, branch, seek, nb)
+        end
         append!(res, data)
         # FIXME: assuming offset has always 0 or at least 2 elements ;)
         append!(offsets, (@view offset[2:end]) .+ position)
@@ -606,8 +670,15 @@ function readbasket(f::ROOTFile, branch, ith)
 end
 
 function readbasketseek(f::ROOTFile, branch::Union{TBranch, TBranchElement}, seek_pos::Int, nb)
-    local rawbuffer
-    rawbuffer = OffsetBuffer(IOBuffer(read_seek_nb(f.fobj, seek_pos, nb)), seek_pos)
+    t0 = _tic()
+    bytes = read_seek_nb(f.fobj, seek_pos, nb)
+    _toc!(t0, :read, nb)
+    return readbasketbytes(branch, bytes, seek_pos)
+end
+
+# decode the (already read) bytes of the basket record stored at `seek_pos`
+function readbasketbytes(branch::Union{TBranch, TBranchElement}, bytes, seek_pos::Integer)
+    rawbuffer = OffsetBuffer(IOBuffer(bytes), seek_pos)
     basketkey = unpack(rawbuffer, TBasketKey)
     compressedbytes = compressed_datastream(rawbuffer, basketkey)
 
@@ -640,3 +711,275 @@ function readbasketseek(f::ROOTFile, branch::Union{TBranch, TBranchElement}, see
         return resize!(basketrawbytes, contentsize), Int32[]
     end
 end
+
+# reusable decompression buffer; one per task (not per thread, tasks can migrate)
+# so that a buffer is never shared by two concurrent readers
+_basket_arena() = get!(() -> UInt8[], task_local_storage(), :UnROOT_basket_arena)::Vector{UInt8}
+
+# `n` big-endian values of type `T` starting at byte `from` of `src` -> `dst[to:to+n-1]`,
+# loads are unaligned-safe so `src` can be any byte offset into a basket
+function _ntoh_copyto!(dst::Vector{T}, to::Integer, src::AbstractVector{UInt8}, from::Integer, n::Integer) where T
+    checkbounds(dst, to:to+n-1)
+    checkbounds(src, from:from+n*sizeof(T)-1)
+    GC.@preserve dst src begin
+        ps = Ptr{T}(pointer(src, from))
+        pd = pointer(dst, to)
+        @inbounds @simd for i in 1:n
+            unsafe_store!(pd, ntoh(unsafe_load(ps, i)), i)
+        end
+    end
+    return dst
+end
+
+function _ntoh_load(::Type{T}, src::AbstractVector{UInt8}, from::Integer) where T
+    checkbounds(src, from:from+sizeof(T)-1)
+    return GC.@preserve src ntoh(unsafe_load(Ptr{T}(pointer(src, from))))
+end
+
+# element types decoded by the two-pass kernels below (a plain byte-swapping copy)
+_isswappable(::Type{T}) where T = _isfixedwidth(T) || T === Bool
+
+"""
+    _unjagg(E, raw, rawoffsets, jagg_offset)
+
+Two-pass decoding of a singly jagged basket: the `i`-th event is stored in
+`raw[rawoffsets[i]+1:rawoffsets[i+1]]` behind a `jagg_offset` bytes header. The element counts
+(and thus the output offsets) are computed first, then every event is byte-swapped with a
+single bulk copy into the preallocated flat content.
+"""
+function _unjagg(::Type{E}, raw::AbstractVector{UInt8}, rawoffsets, jagg_offset) where E
+    nevents = max(length(rawoffsets) - 1, 0)
+    offsets = Vector{Int32}(undef, nevents + 1)
+    offsets[1] = 1
+    for i in 1:nevents
+        nbytes = rawoffsets[i+1] - rawoffsets[i] - jagg_offset
+        offsets[i+1] = offsets[i] + max(nbytes, 0) ÷ sizeof(E)
+    end
+    content = Vector{E}(undef, offsets[end] - 1)
+    for i in 1:nevents
+        n = offsets[i+1] - offsets[i]
+        n > 0 && _ntoh_copyto!(content, offsets[i], raw, rawoffsets[i] + jagg_offset + 1, n)
+    end
+    return VectorOfVectors(content, offsets, ArraysOfArrays.no_consistency_checks)
+end
+
+"""
+    _unjaggjagg(E, raw, rawoffsets, jagg_offset)
+
+Two-pass decoding of a doubly jagged basket (e.g. `vector<vector<E>>`), where after the header
+of an event each inner vector is stored as its big-endian `Int32` length followed by the
+elements. The first pass walks the length prefixes and fills the event offsets and inner
+lengths, the second pass allocates every inner vector at its final size and byte-swaps it
+in one copy. The result is the same `VectorOfVectors` of `Vector{E}` as the generic path of
+[`interped_data`](@ref), without growing any row with `push!`.
+"""
+function _unjaggjagg(::Type{E}, raw::AbstractVector{UInt8}, rawoffsets, jagg_offset) where E
+    nevents = max(length(rawoffsets) - 1, 0)
+    outer = Vector{Int32}(undef, nevents + 1)
+    outer[1] = 1
+    lengths = Int32[]
+    for i in 1:nevents
+        cursor = rawoffsets[i] + jagg_offset + 1
+        stop = rawoffsets[i+1]
+        while cursor < stop
+            n = _ntoh_load(Int32, raw, cursor)
+            push!(lengths, n)
+            cursor += sizeof(Int32) + n * sizeof(E)
+        end
+        outer[i+1] = length(lengths) + 1
+    end
+    content = Vector{Vector{E}}(undef, length(lengths))
+    for i in 1:nevents
+        cursor = rawoffsets[i] + jagg_offset + 1 + sizeof(Int32)
+        for k in outer[i]:outer[i+1]-1
+            n = lengths[k]
+            content[k] = _ntoh_copyto!(Vector{E}(undef, n), 1, raw, cursor, n)
+            cursor += n * sizeof(E) + sizeof(Int32)
+        end
+    end
+    return VectorOfVectors(content, outer, ArraysOfArrays.no_consistency_checks)
+end
+
+# branches decoded by `_basketarray_mmap` instead of `readbasket` + `interped_data`
+_isfixedwidth(::Type{T}) where T = T <: Union{Integer, AbstractFloat} && T !== Bool && isbitstype(T)
+_hasmmappath(fobj, T, J) = false
+_hasmmappath(::MmapStream, ::Type{T}, ::Type{Nojagg}) where T = _isfixedwidth(T)
+_hasmmappath(::MmapStream, ::Type{T}, ::Type{Offsetjagg}) where T = T <: Vector && _isfixedwidth(eltype(T))
+
+"""
+    _basketarray_mmap(f::ROOTFile, branch, ithbasket, T, J)
+    _basketarray_mmap(f::ROOTFile, branch, iths::AbstractVector, T, J)
+
+Counterpart of [`basketarray`](@ref) for fixed-width numeric `Nojagg` and `Offsetjagg`
+branches of memory-mapped files. The basket is never copied out of the mmap: uncompressed
+payloads are decoded in place, compressed ones are decompressed into a reusable per-task
+arena. The big-endian values are then byte-swapped in a single pass into the output, so
+the output array (plus the offsets for jagged branches) is the only allocation that
+scales with the basket size.
+
+With several baskets `iths` (whole branches for [`array`](@ref), ranges of a
+[`LazyBranch`](@ref)), all basket keys are parsed first to size the output once and the
+baskets are decoded in parallel when Julia runs with several threads. Flat baskets are
+decoded straight into their slice of the output; jagged ones into one array per basket,
+concatenated afterwards (only when threaded, serially they are appended in place).
+"""
+function _basketarray_mmap(f::ROOTFile, branch, ithbasket::Integer, ::Type{T}, ::Type{J}) where {T, J}
+    basketkey = _mmap_basketkey(f, branch, ithbasket)
+    return _decode_basket(_mmap_basketpayload(f, branch, ithbasket, basketkey), basketkey, T, J)
+end
+
+function _basketarray_mmap(f::ROOTFile, branch, iths::AbstractVector{<:Integer}, ::Type{T}, ::Type{Nojagg}) where T
+    basketkeys = [_mmap_basketkey(f, branch, i) for i in iths]
+    counts = [_contentsize(k) ÷ sizeof(T) for k in basketkeys]
+    starts = cumsum([1; counts[1:end-1]])
+    out = Vector{T}(undef, sum(counts; init=0))
+    # every basket writes its own slice of `out`
+    _mapbaskets(f, branch, length(iths)) do k
+        payload = _mmap_basketpayload(f, branch, iths[k], basketkeys[k])
+        _ntoh_copyto!(out, starts[k], payload, 1, counts[k])
+        nothing
+    end
+    return out
+end
+
+function _basketarray_mmap(f::ROOTFile, branch, iths::AbstractVector{<:Integer}, ::Type{T}, ::Type{Offsetjagg}) where T
+    E = eltype(T)
+    basketkeys = [_mmap_basketkey(f, branch, i) for i in iths]
+    # every event starts with its header, the rest of the content are the elements
+    ncontents = [max(_contentsize(k) - offsetof(Offsetjagg) * _nevents(k), 0) ÷ sizeof(E) for k in basketkeys]
+    if !_parallelbaskets(length(iths))
+        offsets = sizehint!(Int32[1], sum(_nevents, basketkeys; init=0) + 1)
+        content = sizehint!(E[], sum(ncontents; init=0))
+        _mapbaskets(f, branch, length(iths)) do k
+            _append_unjagg!(content, offsets, _mmap_basketpayload(f, branch, iths[k], basketkeys[k]), basketkeys[k])
+            nothing
+        end
+        return VectorOfVectors(content, offsets, ArraysOfArrays.no_consistency_checks)
+    end
+    # the offsets of a basket depend on the content of the previous ones: decode every
+    # basket on its own, then concatenate
+    parts = _mapbaskets(f, branch, length(iths)) do k
+        offsets = sizehint!(Int32[1], _nevents(basketkeys[k]) + 1)
+        content = sizehint!(E[], ncontents[k])
+        _append_unjagg!(content, offsets, _mmap_basketpayload(f, branch, iths[k], basketkeys[k]), basketkeys[k])
+        content, offsets
+    end
+    content = Vector{E}(undef, sum(p -> length(p[1]), parts; init=0))
+    offsets = Vector{Int32}(undef, sum(p -> length(p[2]) - 1, parts; init=0) + 1)
+    offsets[1] = 1
+    pos, ev = 0, 1
+    for (c, o) in parts
+        copyto!(content, pos + 1, c, 1, length(c))
+        @views offsets[ev+1:ev+length(o)-1] .= o[2:end] .+ Int32(pos)
+        pos += length(c)
+        ev += length(o) - 1
+    end
+    return VectorOfVectors(content, offsets, ArraysOfArrays.no_consistency_checks)
+end
+
+_parallelbaskets(n) = n > 1 && Threads.nthreads() > 1
+
+# `g(k)` for the k-th of `n` baskets, spread over the threads when there are several;
+# every basket gets its own profiling scope since spawned tasks don't inherit it
+function _mapbaskets(g, f::ROOTFile, branch, n)
+    body(k) = _profiled(() -> g(k), f.profile, branch)
+    _parallelbaskets(n) || return map(body, 1:n)
+    res = Vector{Any}(undef, n)
+    Threads.@threads for k in 1:n
+        res[k] = body(k)
+    end
+    return res
+end
+
+# only the (small) key is copied out of the mmap: fKeylen sits after fNbytes, fVersion,
+# fObjlen and fDatime
+function _mmap_basketkey(f::ROOTFile, branch, ithbasket)
+    seek_pos = branch.fBasketSeek[ithbasket]
+    keylen = _ntoh_load(Int16, f.fobj.mmap_ary, seek_pos + 15)
+    return unpack(IOBuffer(f.fobj.mmap_ary[seek_pos+1:seek_pos+keylen]), TBasketKey)
+end
+
+# the uncompressed payload of a basket: a view into the mmap, or this task's arena
+function _mmap_basketpayload(f::ROOTFile, branch, ithbasket, basketkey)
+    seek_pos = branch.fBasketSeek[ithbasket]
+    # the pages are only faulted in while decompressing or decoding, so the read stage
+    # of memory-mapped baskets accounts their bytes but (almost) no time
+    t0 = _tic()
+    bytes = @view f.fobj.mmap_ary[seek_pos+1:seek_pos+branch.fBasketBytes[ithbasket]]
+    _toc!(t0, :read, length(bytes))
+    payload = @view bytes[basketkey.fKeylen+1:basketkey.fNbytes]
+    iscompressed(basketkey) || return payload
+    return decompress_blocks!(resize!(_basket_arena(), basketkey.fObjlen), payload)
+end
+
+_contentsize(basketkey) = basketkey.fLast - basketkey.fKeylen
+# same layout as in `readbasketbytes`: Int32 offsets after the content (+4 bytes),
+# followed by 4 trailing bytes
+_nevents(basketkey) = max(basketkey.fObjlen - _contentsize(basketkey) - 8, 0) ÷ sizeof(Int32)
+_rawoffset(raw, basketkey, i) = _ntoh_load(Int32, raw, _contentsize(basketkey) + 4 + 4(i-1) + 1) - basketkey.fKeylen
+
+function _decode_basket(raw::AbstractVector{UInt8}, basketkey, ::Type{T}, ::Type{Nojagg}) where T
+    out = Vector{T}(undef, _contentsize(basketkey) ÷ sizeof(T))
+    return _ntoh_copyto!(out, 1, raw, 1, length(out))
+end
+
+function _decode_basket(raw::AbstractVector{UInt8}, basketkey, ::Type{T}, ::Type{Offsetjagg}) where T
+    nevents = _nevents(basketkey)
+    rawoffsets = Vector{Int32}(undef, nevents + 1)
+    for i in 1:nevents
+        rawoffsets[i] = _rawoffset(raw, basketkey, i)
+    end
+    rawoffsets[end] = _contentsize(basketkey)
+    return _unjagg(eltype(T), raw, rawoffsets, offsetof(Offsetjagg))
+end
+
+# `_unjagg` of one basket, appended to the `content` and (1-based) `offsets` of the
+# previous ones
+function _append_unjagg!(content::Vector{E}, offsets::Vector{Int32}, raw, basketkey) where E
+    jagg_offset = offsetof(Offsetjagg)
+    nevents = _nevents(basketkey)
+    start = length(offsets)
+    for i in 1:nevents
+        stop = i == nevents ? _contentsize(basketkey) : _rawoffset(raw, basketkey, i + 1)
+        nbytes = stop - _rawoffset(raw, basketkey, i) - jagg_offset
+        push!(offsets, offsets[end] + max(nbytes, 0) ÷ sizeof(E))
+    end
+    resize!(content, offsets[end] - 1)
+    for i in 1:nevents
+        n = offsets[start+i] - offsets[start+i-1]
+        n > 0 && _ntoh_copyto!(content, offsets[start+i-1], raw, _rawoffset(raw, basketkey, i) + jagg_offset + 1, n)
+    end
+    return content
+end
+
+# baskets of `b` overlapping the (1-based) entry range `r`, i.e. including the baskets
+# which only partially cover it at either end (not only those fully contained in `r`)
+function _basketsin(b, r::UnitRange)
+    entries = @view b.fBasketEntry[1:numbaskets(b)]
+    return max(searchsortedlast(entries, first(r) - 1), 1):searchsortedlast(entries, last(r) - 1)
+end
+
+"""
+    fetchbaskets(f::ROOTFile, branches, entries::UnitRange; gap=DEFAULT_READ_GAP, stats=nothing)
+    fetchbaskets(f::ROOTFile, branches, keys::AbstractVector{Tuple{Int, Int}}; gap=DEFAULT_READ_GAP, stats=nothing)
+
+Read the on-disk records of all baskets of `branches` overlapping `entries` (or of the
+explicitly given `(branch index, basket index)` pairs) with one coalesced read plan, see
+[`read_seek_nb_multi`](@ref). Returns a `Dict` mapping `(branch index, basket index)` to the
+basket bytes, which [`readbasketbytes`](@ref) turns into raw data and offsets just like
+[`readbasket`](@ref).
+
+This is what makes reading a cluster of a wide tree over HTTP cost a handful of round trips
+instead of one per basket.
+"""
+function fetchbaskets(f::ROOTFile, branches, entries::UnitRange; kwargs...)
+    keys = [(s, j) for (s, b) in enumerate(branches) for j in _basketsin(b, entries) if b.fBasketSeek[j] != 0]
+    return fetchbaskets(f, branches, keys; kwargs...)
+end
+
+function fetchbaskets(f::ROOTFile, branches, keys::AbstractVector{Tuple{Int, Int}}; gap::Integer=DEFAULT_READ_GAP, stats=nothing)
+    seeks = [branches[s].fBasketSeek[j] for (s, j) in keys]
+    nbs = [branches[s].fBasketBytes[j] for (s, j) in keys]
+    chunks = read_seek_nb_multi(f.fobj, seeks, nbs; gap, stats)
+    return Dict(zip(keys, chunks))
+end
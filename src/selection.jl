@@ -0,0 +1,108 @@
+"""
+    filterentries(pred, t::LazyTree, columns; entries=nothing) -> Vector{Int}
+
+Evaluate the row predicate `pred` on the `columns` (a `Symbol` or a collection of `Symbol`s)
+of `t` and return the sorted indices of the rows passing it. `pred` receives a `NamedTuple`
+holding the values of `columns` only:
+
+```julia
+julia> idx = UnROOT.filterentries(evt -> any(>(50), evt.Muon_pt), t, :Muon_pt);
+
+julia> sum(length, view(t, idx).Jet_pt)
+```
+
+The predicate columns are read one cluster (see `_clusterranges`, for both TTrees and
+RNTuples) at a time, clusters are processed in parallel. `entries` restricts the evaluation
+to a list of candidate rows, e.g. from a [`indexentries`](@ref) lookup: clusters without any
+candidate are not read at all. The candidates are taken as a set, each row passing `pred` is
+returned once however often it appears in `entries`.
+
+Every cluster of the predicate columns is read as one range of the column, which goes
+through the file's basket cache (`ROOTFile(...; basketcache_size)`) like the single-row
+reads do, so reading the same columns through `view(t, idx)` afterwards hits the cache.
+
+The result is meant for `view(t, idx)` (or `t[idx]`): reading the remaining branches through
+it only decompresses the baskets (clusters for RNTuple) that contain surviving rows, so a
+selective cut skips most of the payload.
+
+!!! note
+    Don't combine this with `LazyTree(...; prefetch=N)`, the read-ahead does not know about
+    the selection and would fetch the skipped clusters anyway.
+"""
+function filterentries(pred, t::LazyTree, columns; entries=nothing)
+    names = columns isa Symbol ? (columns,) : Tuple(Symbol.(columns))
+    isempty(names) && throw(ArgumentError("no columns given for the predicate"))
+    cols = NamedTuple{names}(map(n -> getproperty(t, n), names))
+    clusters = _filterclusters(collect(values(cols)))
+    # strictly increasing, duplicates would evaluate (and return) a row several times
+    candidates = (isnothing(entries) || issorted(entries; lt=(<=))) ? entries : unique!(sort(entries))
+    selected = Vector{Vector{Int}}(undef, length(clusters))
+    Threads.@threads for ic in eachindex(clusters)
+        r = clusters[ic]
+        rows = isnothing(candidates) ? r : _candidatesin(candidates, r)
+        selected[ic] = isempty(rows) ? Int[] : _filtercluster(pred, map(col -> col[r], cols), first(r), rows)
+    end
+    return reduce(vcat, selected; init=Int[])
+end
+
+# function barrier: `data` holds one cluster-worth of every predicate column
+function _filtercluster(pred, data::NamedTuple, start, rows)
+    out = Int[]
+    for i in rows
+        pred(map(d -> d[i - start + 1], data)) && push!(out, i)
+    end
+    return out
+end
+
+_candidatesin(candidates, r) = @view candidates[searchsortedfirst(candidates, first(r)):searchsortedlast(candidates, last(r))]
+
+# entry ranges the predicate is evaluated on; in-memory columns (e.g. of `t[1:100]`)
+# and the entries after the last full basket (recovered baskets) form one range each
+function _filterclusters(cols)
+    clusters = if cols isa AbstractVector{<:Union{LazyBranch, RNTupleField}}
+        map(UnitRange{Int}, _clusterranges(cols))
+    else
+        UnitRange{Int}[]
+    end
+    n = length(first(cols))
+    stop = isempty(clusters) ? 0 : last(last(clusters))
+    stop < n && push!(clusters, stop+1:n)
+    return clusters
+end
+
+"""
+    indexentries(tree::TTree, major[, minor]) -> Vector{Int}
+    indexentries(f::ROOTFile, treepath, major[, minor])
+    indexentries(index::TTreeIndex, major[, minor])
+
+Key lookup in the `TTreeIndex` of a TTree (see `TTree::BuildIndex` in ROOT): return the
+sorted (1-based) indices of the rows whose major key is in `major` and, if given, whose minor
+key is in `minor`. Keys can be single values, ranges or collections, e.g. a run number and a
+range of luminosity blocks. Only the index is read, no basket is touched; pass the result as
+`entries` to [`filterentries`](@ref) or use it in `view(t, idx)` directly.
+"""
+function indexentries(tree::TTree, major, minor=nothing)
+    index = tree.fTreeIndex
+    index isa TTreeIndex || error("TTree $(tree.fName) has no TTreeIndex")
+    return indexentries(index, major, minor)
+end
+
+function indexentries(index::TTreeIndex, major, minor=nothing)
+    majors = index.fIndexValues
+    minors = index.fIndexValuesMinor
+    !isnothing(minor) && isempty(minors) && !isempty(majors) &&
+        error("the TTreeIndex $(index.fName) has no minor key")
+    # ROOT sorts the index by (major, minor), so the candidates are one contiguous block;
+    # an index which is not sorted is scanned in full instead
+    candidates = if issorted(majors)
+        searchsortedfirst(majors, minimum(major)):searchsortedlast(majors, maximum(major))
+    else
+        eachindex(majors)
+    end
+    return sort!([index.fIndex[i] + 1 for i in candidates
+                  if majors[i] ∈ major && (isnothing(minor) || minors[i] ∈ minor)])
+end
+
+function indexentries(f::ROOTFile, treepath::AbstractString, major, minor=nothing)
+    return indexentries(f[treepath], major, minor)
+end
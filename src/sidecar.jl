@@ -0,0 +1,91 @@
+# bumped whenever the content of the index (or the layout of the parsed objects) changes
+const METADATA_INDEX_VERSION = 2
+const METADATA_INDEX_EXTENSION = ".unrootindex"
+
+# the default index of a file sits next to it, the only place its name is built
+_default_metadata_index_path(filename::AbstractString) = filename * METADATA_INDEX_EXTENSION
+
+_metadata_index_path(f::ROOTFile, path::AbstractString) = path
+_metadata_index_path(f::ROOTFile, enabled::Bool) = enabled ? _default_metadata_index_path(f.filename) : nothing
+
+# what tells a file apart from any other file, including a rewritten version of itself
+_metadata_identity(f::ROOTFile) = (f.header.fUUID, Int(f.header.fEND), Int(f.header.fSeekInfo),
+                                   Int(f.directory.header.fSeekKeys))
+
+# size and modification time of a local file, which catch a file modified in place without
+# touching its records; remote files only have their identity
+function _metadata_source(f::ROOTFile)
+    isfile(f.filename) || return nothing
+    st = stat(f.filename)
+    return (; size = st.size, mtime = st.mtime)
+end
+
+"""
+    write_metadata_index(f::ROOTFile, path = "$(f.filename).unrootindex")
+
+Write a sidecar index with the metadata of `f`: the streamers and all top-level trees (plus
+the trees of subdirectories which were already looked up), i.e. the branch list, the leaf
+types and the seek positions, sizes and entries of all baskets. Opening the file again with
+`ROOTFile(filename; metadata_index = path)` (or `metadata_index = true` for the default
+`path`) takes the trees from the index instead of reading and parsing them, which is where
+most of the time goes when opening files with thousands of branches.
+
+The index is only valid for this very file (its UUID, the position of its records and, for
+local files, its size and modification time) and the versions of UnROOT and Julia which
+wrote it, in any other case it is ignored. It is
+written to a temporary file which is then moved in place, so jobs opening the file
+concurrently never see a partial index.
+
+!!! warning
+    The index is stored with Julia's `Serialization`: only load indices you wrote yourself.
+"""
+function write_metadata_index(f::ROOTFile, path::AbstractString = _default_metadata_index_path(f.filename))
+    trees = Dict{String, TTree}()
+    for tkey in f.directory.keys
+        tkey.fClassName == "TTree" && (trees[tkey.fName] = f[tkey.fName])
+    end
+    Base.@lock f.cachelock for (k, v) in f.cache
+        v isa TTree && (trees[k] = v)
+    end
+    index = (; version = METADATA_INDEX_VERSION, unroot = pkgversion(@__MODULE__), julia = VERSION,
+             identity = _metadata_identity(f), source = _metadata_source(f),
+             streamers = Streamers(f.streamers), trees)
+    tmp = "$path.$(getpid()).tmp"
+    open(io -> Serialization.serialize(io, index), tmp, "w")
+    mv(tmp, path; force=true)
+    return path
+end
+
+function _load_metadata_index!(f::ROOTFile, path)
+    (isnothing(path) || !isfile(path)) && return f
+    index = try
+        open(Serialization.deserialize, path)
+    catch e
+        @debug "Ignoring unreadable metadata index $path" exception=e
+        return f
+    end
+    valid = index isa NamedTuple && get(index, :version, nothing) == METADATA_INDEX_VERSION &&
+            index.unroot == pkgversion(@__MODULE__) && index.julia == VERSION &&
+            index.identity == _metadata_identity(f) && index.source == _metadata_source(f)
+    if !valid
+        @debug "Ignoring metadata index $path, it was written for another file or version"
+        return f
+    end
+    @atomic f.streamers.parsed = index.streamers
+    Base.@lock f.cachelock merge!(f.cache, index.trees)
+    return f
+end
+
+# a `Cursor` points into the buffer its object was parsed from, which is of no use once
+# the object is parsed: only its position and key go into the index
+function Serialization.serialize(s::Serialization.AbstractSerializer, c::Cursor)
+    Serialization.serialize_type(s, Cursor)
+    Serialization.serialize(s, c.start)
+    Serialization.serialize(s, c.tkey)
+end
+
+function Serialization.deserialize(s::Serialization.AbstractSerializer, ::Type{Cursor})
+    start = Serialization.deserialize(s)
+    tkey = Serialization.deserialize(s)
+    return Cursor(start, IOBuffer(), tkey, Dict{Int32, Any}())
+end
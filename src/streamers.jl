@@ -20,6 +20,52 @@ function Base.show(io::IO, s::Streamers)
     end
 end
 
+"""
+    LazyStreamers
+
+The streamer infos of a [`ROOTFile`](@ref), parsed on first use instead of when the file is
+opened: accessing `elements`, `length`, `show` or `streamerfor` parses them (once,
+under their own lock, with a positioned read which does not need the file lock). Plain
+`TTree`s and RNTuples never need them, so opening a file and reading such a tree skips the
+streamer record altogether.
+
+`refs` is the reference table of the objects read from the file (see [`readobjany!`](@ref))
+and is available right away; the streamer record uses a table of its own, since object
+references are local to the buffer of one key.
+"""
+mutable struct LazyStreamers
+    const fobj::AbstractSourceStream
+    const seek::Int
+    const nbytes::Int
+    const refs::Dict{Int32, Any}
+    const lock::ReentrantLock
+    @atomic parsed::Union{Nothing, Streamers}
+end
+LazyStreamers(fobj, seek, nbytes) = LazyStreamers(fobj, seek, nbytes, Dict{Int32, Any}(), ReentrantLock(), nothing)
+
+function Streamers(s::LazyStreamers)
+    parsed = @atomic s.parsed
+    isnothing(parsed) || return parsed
+    Base.@lock getfield(s, :lock) begin
+        parsed = @atomic s.parsed
+        if isnothing(parsed)
+            seek, nbytes = getfield(s, :seek), getfield(s, :nbytes)
+            # the record is exactly fNbytesInfo bytes; a fixed-size read would truncate
+            # large streamer records and over-read remote files
+            bytes = read_seek_nb(getfield(s, :fobj), seek, nbytes)
+            parsed = Streamers(OffsetBuffer(IOBuffer(bytes), seek))
+            @atomic s.parsed = parsed
+        end
+        return parsed
+    end
+end
+
+function Base.getproperty(s::LazyStreamers, name::Symbol)
+    name === :refs && return getfield(s, :refs)
+    return getproperty(Streamers(s), name)
+end
+Base.length(s::LazyStreamers) = length(Streamers(s))
+Base.show(io::IO, s::LazyStreamers) = show(io, Streamers(s))
 
 # Structures required to read streamers
 struct TStreamerInfo{T}
@@ -64,3 +64,128 @@ function Base.read(fobj::AbstractSourceStream)
     # seekloc is 0-based, so the remainder is exactly size - seekloc
     read(fobj, fobj.size - fobj.seekloc)
 end
+
+"""
+    ReadStats
+
+Counters of a [`read_seek_nb_multi`](@ref) read plan, meant for tuning the gap threshold:
+
+- `roundtrips`: number of requests issued to the source
+- `ranges`: number of byte ranges requested by the caller
+- `bytes_requested`: sum of the requested range lengths
+- `bytes_read`: bytes actually transferred, see [`overread`](@ref)
+
+The counters are atomic so one `ReadStats` can be shared by concurrent readers.
+"""
+struct ReadStats
+    roundtrips::Threads.Atomic{Int}
+    ranges::Threads.Atomic{Int}
+    bytes_requested::Threads.Atomic{Int}
+    bytes_read::Threads.Atomic{Int}
+end
+ReadStats() = ReadStats((Threads.Atomic{Int}(0) for _ in 1:4)...)
+
+"""
+    overread(s::ReadStats)
+
+Number of bytes transferred only to fill the gaps between coalesced ranges.
+"""
+overread(s::ReadStats) = s.bytes_read[] - s.bytes_requested[]
+
+function Base.show(io::IO, s::ReadStats)
+    print(io, "ReadStats($(s.ranges[]) ranges in $(s.roundtrips[]) round trips, ",
+          "$(s.bytes_read[]) bytes read, $(overread(s)) bytes over-read)")
+end
+
+# two ranges separated by less than this many bytes are fetched with one request
+const DEFAULT_READ_GAP = 64 * 1024
+
+"""
+    CoalescedRead
+
+One entry of a read plan (see [`plan_reads`](@ref)): the byte range `[seek, seek+nb)` covers
+the requested ranges with indices `members`.
+"""
+struct CoalescedRead
+    seek::Int
+    nb::Int
+    members::Vector{Int}
+end
+
+"""
+    plan_reads(seeks, nbs; gap=DEFAULT_READ_GAP)
+
+Merge the byte ranges `[seeks[i], seeks[i]+nbs[i])` into a sorted list of
+[`CoalescedRead`](@ref)s: overlapping or adjacent ranges, as well as ranges separated by at
+most `gap` bytes, end up in the same read.
+"""
+function plan_reads(seeks, nbs; gap::Integer=DEFAULT_READ_GAP)
+    plan = CoalescedRead[]
+    for i in sortperm(seeks)
+        start, stop = Int(seeks[i]), Int(seeks[i] + nbs[i])
+        if !isempty(plan) && start - (last(plan).seek + last(plan).nb) <= gap
+            r = last(plan)
+            push!(r.members, i)
+            plan[end] = CoalescedRead(r.seek, max(r.nb, stop - r.seek), r.members)
+        else
+            push!(plan, CoalescedRead(start, stop - start, [i]))
+        end
+    end
+    return plan
+end
+
+"""
+    read_ranges(fobj::AbstractSourceStream, seeks, nbs)
+
+Read several byte ranges from `fobj`, returning the buffers together with the number of
+requests that were needed. Sources which support vectored (multi-range) requests overload
+this; the fallback issues one [`read_seek_nb`](@ref) per range.
+"""
+read_ranges(fobj::AbstractSourceStream, seeks, nbs) = _read_ranges_sequential(fobj, seeks, nbs)
+
+function _read_ranges_sequential(fobj, seeks, nbs)
+    return [read_seek_nb(fobj, s, n) for (s, n) in zip(seeks, nbs)], length(seeks)
+end
+
+"""
+    read_seek_nb_multi(fobj::AbstractSourceStream, seeks, nbs; gap=DEFAULT_READ_GAP, stats=nothing)
+
+Vectored version of `read_seek_nb`: returns one buffer per requested range. The ranges are
+first coalesced with [`plan_reads`](@ref), then fetched with [`read_ranges`](@ref) (e.g. a
+single multi-range request for HTTP) and finally sliced back. Pass a [`ReadStats`](@ref) as
+`stats` to record round trips and over-read bytes.
+
+For a memory-mapped `MmapStream` (local files) `gap` does not apply: there are no round trips to
+save, so every range is sliced directly out of the mapping and `stats` records one read per
+range without over-read.
+"""
+function read_seek_nb_multi(fobj::AbstractSourceStream, seeks, nbs; gap::Integer=DEFAULT_READ_GAP, stats=nothing)
+    plan = plan_reads(seeks, nbs; gap)
+    chunks, nrequests = read_ranges(fobj, [r.seek for r in plan], [r.nb for r in plan])
+    out = Vector{Vector{UInt8}}(undef, length(seeks))
+    for (r, chunk) in zip(plan, chunks)
+        for i in r.members
+            lo = seeks[i] - r.seek
+            out[i] = chunk[lo+1:lo+nbs[i]]
+        end
+    end
+    if !isnothing(stats)
+        Threads.atomic_add!(stats.roundtrips, nrequests)
+        Threads.atomic_add!(stats.ranges, length(seeks))
+        Threads.atomic_add!(stats.bytes_requested, Int(sum(nbs; init=0)))
+        Threads.atomic_add!(stats.bytes_read, sum(r.nb for r in plan; init=0))
+    end
+    return out
+end
+
+# a local file has no round trips to save, coalescing would only add a copy: `gap` is
+# ignored and every range counts as its own read in `stats`
+function read_seek_nb_multi(fobj::MmapStream, seeks, nbs; gap::Integer=DEFAULT_READ_GAP, stats=nothing)
+    if !isnothing(stats)
+        Threads.atomic_add!(stats.roundtrips, length(seeks))
+        Threads.atomic_add!(stats.ranges, length(seeks))
+        Threads.atomic_add!(stats.bytes_requested, Int(sum(nbs; init=0)))
+        Threads.atomic_add!(stats.bytes_read, Int(sum(nbs; init=0)))
+    end
+    return [read_seek_nb(fobj, s, n) for (s, n) in zip(seeks, nbs)]
+end
@@ -144,43 +144,127 @@ function decompress_datastreambytes(compbytes, tkey)
     iscompressed(tkey) || return compbytes
 
     # compressed
-    io = IOBuffer(compbytes)
-    fulfilled = 0
     uncomp_data = Vector{UInt8}(undef, tkey.fObjlen)
-    while fulfilled < tkey.fObjlen # careful with 0/1-based index when thinking about offsets
-        compression_header = unpack(io, CompressionHeader)
-        cname, _, compbytes, uncompbytes = unpack(compression_header)
-        rawbytes = read(io, compbytes)
+    return decompress_blocks!(uncomp_data, compbytes)
+end
+
+# size of the header in front of every ROOT compression block
+const COMPRESSION_HEADER_SIZE = 9
+
+# algorithm, compressed and uncompressed size of the compression block at `src[pos]`,
+# same as `unpack(::CompressionHeader)` but without going through an `IO`
+@inline function _compressionblock(src, pos)
+    @inbounds begin
+        algo = SVector{2, UInt8}(src[pos], src[pos+1])
+        compbytes = Int(src[pos+3]) + (Int(src[pos+4]) << 8) + (Int(src[pos+5]) << 16)
+        uncompbytes = Int(src[pos+6]) + (Int(src[pos+7]) << 8) + (Int(src[pos+8]) << 16)
+    end
+    return algo, compbytes, uncompbytes
+end
+
+# one ROOT compression block: algorithm, payload range in `src` and output range in `dst`
+struct CompressionBlock
+    algo::SVector{2, UInt8}
+    src::UnitRange{Int}
+    dst::UnitRange{Int}
+end
+
+# walk the chain of block headers in `src` which decompress to `ndst` bytes in total
+function _scanblocks(src::AbstractVector{UInt8}, ndst::Integer)
+    blocks = CompressionBlock[]
+    fulfilled = 0
+    pos = firstindex(src)
+    while fulfilled < ndst # careful with 0/1-based index when thinking about offsets
+        pos + COMPRESSION_HEADER_SIZE - 1 <= lastindex(src) || error("Truncated chain of compression blocks")
+        cname, compbytes, uncompbytes = _compressionblock(src, pos)
         @debug "Compression type: $(cname)"
         @debug "Compressed/uncompressed size in bytes: $(compbytes) / $(uncompbytes)"
+        start = pos + COMPRESSION_HEADER_SIZE
+        (start + compbytes - 1 <= lastindex(src) && fulfilled + uncompbytes <= ndst) ||
+            error("Compression block sizes ($compbytes/$uncompbytes bytes) exceed the buffer")
+        push!(blocks, CompressionBlock(cname, start:start+compbytes-1, fulfilled+1:fulfilled+uncompbytes))
+        pos = start + compbytes
+        fulfilled += uncompbytes
+    end
+    return blocks
+end
+
+"""
+    decompress_blocks!(dst, src)
 
-        if cname == @SVector UInt8['L', '4']
-            # skip checksum which is 8 bytes
-            # original: lz4_decompress(rawbytes[9:end], uncompbytes)
-            input = @view rawbytes[9:end]
-            # raw Ptr arguments do not root their parent arrays in the ccall
-            GC.@preserve rawbytes uncomp_data begin
-                input_ptr = pointer(input)
-                input_size = length(input)
-                output_ptr = pointer(uncomp_data) + fulfilled
-                output_size = uncompbytes
-                _decompress_lz4!(input_ptr, input_size, output_ptr, output_size)
-            end
-        elseif cname == @SVector UInt8['Z', 'L']
-            output = @view(uncomp_data[fulfilled+1:fulfilled+uncompbytes])
-            zlib_decompress!(Decompressor(), output, rawbytes, uncompbytes)
-        elseif cname == @SVector UInt8['X', 'Z']
-            @view(uncomp_data[fulfilled+1:fulfilled+uncompbytes]) .= transcode(XzDecompressor, rawbytes)
-        elseif cname == @SVector UInt8['Z', 'S']
-            @view(uncomp_data[fulfilled+1:fulfilled+uncompbytes]) .= transcode(ZstdDecompressor, rawbytes)
-        else
-            error("Unsupported compression type '$(String(compression_header.algo))'")
+Decompress the chain of ROOT compression blocks in `src` (each block is a 9 bytes header
+followed by its compressed payload) into `dst`, which must have the total uncompressed size.
+`src` and `dst` can be any contiguous byte vectors (e.g. views into a memory-mapped file), the
+blocks are decompressed straight from `src`, without intermediate copies.
+
+A single block holds at most 16 MiB, larger baskets and pages consist of several independent
+blocks. The block headers are scanned first, and when there is more than one block they are
+decompressed concurrently (one task per block, each writing its own slice of `dst`).
+"""
+function decompress_blocks!(dst::AbstractVector{UInt8}, src::AbstractVector{UInt8})
+    t0 = _tic()
+    blocks = _scanblocks(src, length(dst))
+    if length(blocks) > 1 && Threads.nthreads() > 1
+        @sync for blk in blocks
+            Threads.@spawn _decompress_block!(view(dst, blk.dst), view(src, blk.src), blk.algo)
+        end
+    else
+        for blk in blocks
+            _decompress_block!(view(dst, blk.dst), view(src, blk.src), blk.algo)
         end
+    end
+    # every block carries its own algorithm, so a basket can mix several codecs
+    _toc!(t0, :decompress, length(dst), (blk.algo for blk in blocks))
+    return dst
+end
 
-        fulfilled += uncompbytes
+function _decompress_block!(output, input, cname)
+    if cname == @SVector UInt8['L', '4']
+        # skip checksum which is 8 bytes
+        # raw Ptr arguments do not root their parent arrays in the ccall
+        GC.@preserve input output begin
+            _decompress_lz4!(pointer(input, 9), length(input) - 8, pointer(output), length(output))
+        end
+    elseif cname == @SVector UInt8['Z', 'L']
+        zlib_decompress!(Decompressor(), output, input, length(output))
+    elseif cname == @SVector UInt8['X', 'Z']
+        _decompress_xz!(output, input)
+    elseif cname == @SVector UInt8['Z', 'S']
+        _decompress_zstd!(output, input)
+    else
+        error("Unsupported compression type '$(String(cname))'")
+    end
+    return output
+end
+
+# one-shot decoding of a complete zstd frame into `output`
+function _decompress_zstd!(output, input)
+    LibZstd = CodecZstd.LibZstd
+    ret = GC.@preserve input output begin
+        LibZstd.ZSTD_decompress(pointer(output), length(output), pointer(input), length(input))
     end
-    return uncomp_data
+    iszero(LibZstd.ZSTD_isError(ret)) ||
+        error("zstd decompression failed: $(unsafe_string(LibZstd.ZSTD_getErrorName(ret)))")
+    ret == length(output) || error("zstd block decompressed to $ret bytes, expected $(length(output))")
+    return output
 end
+
+# one-shot decoding of a complete .xz stream into `output`
+function _decompress_xz!(output, input)
+    memlimit = Ref(typemax(UInt64))
+    inpos = Ref{Csize_t}(0)
+    outpos = Ref{Csize_t}(0)
+    ret = GC.@preserve input output begin
+        ccall((:lzma_stream_buffer_decode, CodecXz.liblzma), Cint,
+              (Ref{UInt64}, UInt32, Ptr{Cvoid}, Ptr{UInt8}, Ref{Csize_t}, Csize_t, Ptr{UInt8}, Ref{Csize_t}, Csize_t),
+              memlimit, 0, C_NULL, pointer(input), inpos, length(input), pointer(output), outpos, length(output))
+    end
+    # 0 is LZMA_OK
+    iszero(ret) || error("xz decompression failed with lzma_ret $ret")
+    outpos[] == length(output) || error("xz block decompressed to $(outpos[]) bytes, expected $(length(output))")
+    return output
+end
+
 @io struct FilePreamble
     identifier::SVector{4, UInt8}  # Root file identifier ("root")
     fVersion::Int32                # File format version
@@ -1,13 +1,13 @@
 using UnROOT
 using Test
 using Random: MersenneTwister
-using Tables: columntable
+using Tables: columntable, schema
 
 # round-trip helper: write `table` to a fresh file and read it back as a LazyTree
-function _write_read(table; file_name="roundtrip.root", rntuple_name="myntuple", compression=UnROOT.RNT_DEFAULT_COMPRESSION)
+function _write_read(table; file_name="roundtrip.root", rntuple_name="myntuple", compression=UnROOT.RNT_DEFAULT_COMPRESSION, kwargs...)
     path = joinpath(mktempdir(), file_name)
     open(path, "w") do io
-        UnROOT.write_rntuple(io, table; file_name, rntuple_name, compression)
+        UnROOT.write_rntuple(io, table; file_name, rntuple_name, compression, kwargs...)
     end
     return LazyTree(path, rntuple_name)
 end
@@ -108,3 +108,108 @@ end
         @test collect(t.r) == table.r
     end
 end
+
+# a table with every kind of column, `n` rows
+function _streaming_table(n)
+    rng = MersenneTwister(42)
+    return (;
+        i = collect(Int64, 1:n),
+        f = rand(rng, Float32, n),
+        b = [isodd(i ÷ 3) for i in 1:n],
+        s = ["evt_$(i % 13)" ^ (i % 3) for i in 1:n],
+        v = [collect(Int32, 1:(i % 7)) for i in 1:n],
+        vv = [[rand(rng, (i % 3)) for _ in 1:(i % 4)] for i in 1:n],
+    )
+end
+
+_batches(table, n) = [map(c -> c[r], table) for r in Iterators.partition(1:length(table.i), n)]
+
+@testset "RNTuple Writing - streaming writer" begin
+    table = _streaming_table(20_000)
+    path = joinpath(mktempdir(), "streaming.root")
+    open(path, "w") do io
+        UnROOT.RNTupleWriter(io, table; rntuple_name="t", page_size=1024, cluster_size=64*1024) do w
+            # uneven batches, clusters end in the middle of a batch
+            for batch in _batches(table, 3_001)
+                append!(w, batch)
+            end
+        end
+    end
+    t = LazyTree(path, "t")
+    @test length(t) == 20_000
+    for c in keys(table)
+        @test all(collect(getproperty(t, c)) .== getproperty(table, c))
+    end
+    ranges = UnROOT._clusterranges([t.i])
+    @test length(ranges) > 1
+    @test first(first(ranges)) == 1 && last(last(ranges)) == 20_000
+    @test all(last(r1) + 1 == first(r2) for (r1, r2) in zip(ranges, ranges[2:end]))
+    # several pages per column and cluster, with the element offsets of the later clusters
+    page_list = UnROOT._read_page_list(t.i.rn, 1)
+    @test length(page_list.nested_page_locations[1][1]) > 1
+    @test sum(abs(p.num_elements) for p in page_list.nested_page_locations[1][1]) == length(first(ranges))
+    # the cluster-local offsets are continued across batches and pages
+    @test collect(t.vv[end-100:end]) == table.vv[end-100:end]
+    @test collect(t.s[ranges[2]]) == table.s[ranges[2]]
+
+    # same content as the one-shot writer, which writes one cluster with one page per column
+    t1 = _write_read(table; rntuple_name="t")
+    @test length(UnROOT._clusterranges([t1.i])) == 1
+    @test all(length(l) == 1 for l in UnROOT._read_page_list(t1.i.rn, 1).nested_page_locations[1])
+    for c in keys(table)
+        @test all(collect(getproperty(t1, c)) .== getproperty(t, c))
+    end
+end
+
+@testset "RNTuple Writing - streaming writer edge cases" begin
+    dir = mktempdir()
+    table = _streaming_table(1_000)
+
+    # the schema alone, nothing appended
+    path = joinpath(dir, "empty.root")
+    open(io -> close(UnROOT.RNTupleWriter(io, schema(table); rntuple_name="t")), path, "w")
+    @test length(LazyTree(path, "t")) == 0
+
+    # batches must have the columns of the schema
+    open(joinpath(dir, "mismatch.root"), "w") do io
+        w = UnROOT.RNTupleWriter(io, table; rntuple_name="t")
+        @test_throws ErrorException append!(w, (; i = [1]))
+        @test_throws ErrorException append!(w, (; i = [1], f = Float32[], b = Bool[], s = String[], v = Vector{Int32}[], vv = Vector{Vector{Float64}}[]))
+        close(w)
+        @test_throws ErrorException append!(w, table)
+    end
+
+    # the do-block writes a complete file when it returns, none when it throws
+    path = joinpath(dir, "done.root")
+    open(path, "w") do io
+        @test UnROOT.RNTupleWriter(w -> (append!(w, table); :done), io, table; rntuple_name="t") == :done
+    end
+    @test all(LazyTree(path, "t").i .== table.i)
+    path = joinpath(dir, "failed.root")
+    local writer
+    open(path, "w") do io
+        @test_throws DomainError UnROOT.RNTupleWriter(io, table; rntuple_name="t", cluster_size=16*1024) do w
+            writer = w
+            append!(w, table)
+            throw(DomainError(w, "failed while writing"))
+        end
+    end
+    @test writer.closed && isempty(writer.pending)
+    @test_throws ErrorException append!(writer, table)
+    @test_throws Exception LazyTree(path, "t")
+
+    # 64-bit ROOT file records, as used beyond 2 GB
+    path = joinpath(dir, "bigfile.root")
+    open(path, "w") do io
+        w = UnROOT.RNTupleWriter(io, table; rntuple_name="t", cluster_size=16*1024)
+        append!(w, table)
+        UnROOT._close!(w; bigfile=true)
+    end
+    f = ROOTFile(path)
+    @test f.header isa UnROOT.FileHeader64
+    t = LazyTree(f, "t")
+    for c in keys(table)
+        @test all(collect(getproperty(t, c)) .== getproperty(table, c))
+    end
+    close(f)
+end
@@ -0,0 +1,89 @@
+using Test
+using UnROOT
+using HTTP
+
+# a minimal stand-in for a file server with (multi-)range support
+function _range_handler(bytes, nrequests)
+    return function (req)
+        nrequests[] += 1
+        total = length(bytes)
+        ranges = map(split(chopprefix(HTTP.header(req, "Range"), "bytes="), ',')) do spec
+            a, b = parse.(Int, split(spec, '-'))
+            a:min(b, total - 1)
+        end
+        if length(ranges) == 1
+            r = only(ranges)
+            return HTTP.Response(206, ["Content-Range" => "bytes $(first(r))-$(last(r))/$total"], bytes[r .+ 1])
+        end
+        boundary = "UnROOTTestBoundary"
+        body = IOBuffer()
+        for r in ranges
+            write(body, "\r\n--$boundary\r\nContent-Type: application/octet-stream\r\n")
+            write(body, "Content-Range: bytes $(first(r))-$(last(r))/$total\r\n\r\n")
+            write(body, bytes[r .+ 1])
+        end
+        write(body, "\r\n--$boundary--\r\n")
+        return HTTP.Response(206, ["Content-Type" => "multipart/byteranges; boundary=$boundary"], take!(body))
+    end
+end
+
+@testset "Read planning" begin
+    plan = UnROOT.plan_reads([100, 0, 10, 5000], [10, 10, 20, 5]; gap=100)
+    @test [(r.seek, r.nb) for r in plan] == [(0, 110), (5000, 5)]
+    @test plan[1].members == [2, 3, 1]
+    plan = UnROOT.plan_reads([100, 0, 10, 5000], [10, 10, 20, 5]; gap=0)
+    @test [(r.seek, r.nb) for r in plan] == [(0, 30), (100, 10), (5000, 5)]
+
+    rootfile = UnROOT.samplefile("tree_with_large_array.root")
+    branch = rootfile["t1/float_array"]
+    n = UnROOT.numbaskets(branch)
+    seeks, nbs = branch.fBasketSeek[1:n], branch.fBasketBytes[1:n]
+    expected = [UnROOT.read_seek_nb(rootfile.fobj, s, nb) for (s, nb) in zip(seeks, nbs)]
+    @test UnROOT.read_seek_nb_multi(rootfile.fobj, seeks, nbs) == expected
+    # exercise the generic coalescing path on a local file
+    stats = UnROOT.ReadStats()
+    chunks = invoke(UnROOT.read_seek_nb_multi, Tuple{UnROOT.AbstractSourceStream, Any, Any},
+                    rootfile.fobj, seeks, nbs; gap=typemax(Int), stats)
+    @test chunks == expected
+    @test stats.roundtrips[] == 1
+    @test stats.ranges[] == n
+    @test stats.bytes_requested[] == sum(nbs)
+    @test UnROOT.overread(stats) >= 0
+    close(rootfile)
+end
+
+@testset "Coalesced reads over HTTP" begin
+    localfile = UnROOT.samplefile("tree_with_large_array.root")
+    nrequests = Ref(0)
+    server = HTTP.serve!(_range_handler(read(localfile.filename), nrequests), "127.0.0.1", 8081; listenany=true)
+    try
+        rootfile = ROOTFile("http://127.0.0.1:$(HTTP.port(server))/tree_with_large_array.root")
+        names = ["t1/int32_array", "t1/float_array"]
+        branches = [rootfile[n] for n in names]
+        N = length(LazyBranch(rootfile, branches[1]))
+
+        stats = UnROOT.ReadStats()
+        baskets = UnROOT.fetchbaskets(rootfile, branches, 1:N; gap=filesize(localfile.filename), stats)
+        @test stats.roundtrips[] == 1
+        @test stats.ranges[] == length(baskets)
+        @test UnROOT.overread(stats) >= 0
+        for ((s, j), bytes) in baskets
+            b = branches[s]
+            @test UnROOT.readbasketbytes(b, bytes, b.fBasketSeek[j]) == UnROOT.readbasket(localfile, localfile[names[s]], j)
+        end
+
+        # no gap allowed: still a single multi-range request, but nothing over-read
+        stats = UnROOT.ReadStats()
+        before = nrequests[]
+        UnROOT.fetchbaskets(rootfile, branches, 1:N; gap=0, stats)
+        @test nrequests[] - before == stats.roundtrips[]
+        @test stats.roundtrips[] < stats.ranges[]
+        @test UnROOT.overread(stats) == 0
+
+        t = LazyTree(rootfile, "t1"; prefetch=2)
+        @test collect(t.float_array) == LazyTree(localfile, "t1").float_array[1:end]
+        @test t.float_array.prefetcher.stats.roundtrips[] < UnROOT.numbaskets(branches[2])
+    finally
+        close(server)
+    end
+end
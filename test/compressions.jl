@@ -36,3 +36,71 @@ end
     rootfile = UnROOT.samplefile("issue87_uncompressed_b.root")
     @test LazyTree(rootfile,"Events").myval[2:5] ≈ [[0.1], [0.2, 1.2], [0.3, 1.3, 2.3], [0.4, 1.4, 2.4, 3.4]]
 end
+
+@testset "Decoding baskets from the mmap" begin
+    for (filename, path) in [("tree_with_large_array.root", "t1/float_array"),
+                             ("tree_with_large_array_lz4.root", "t1/float_array"),
+                             ("tree_with_large_array_lzma.root", "t1/float_array"),
+                             ("tree_with_int_array_zstd.root", "t1/a"),
+                             ("uncomressed_lz4_int32.root", "t1/int32_array"),
+                             ("tree_with_jagged_array.root", "t1/int32_array")]
+        rootfile = UnROOT.samplefile(filename)
+        branch = rootfile[path]
+        T, J = UnROOT.auto_T_JaggT(rootfile, branch; customstructs=rootfile.customstructs)
+        for ithbasket in 1:UnROOT.numbaskets(branch)
+            @test UnROOT.basketarray(rootfile, branch, ithbasket) ==
+                  UnROOT.interped_data(UnROOT.readbasket(rootfile, branch, ithbasket)..., T, J)
+        end
+        # whole branches and ranges spanning several baskets
+        arr = UnROOT.array(rootfile, branch)
+        @test arr == UnROOT.interped_data(UnROOT.readbranchraw(rootfile, branch)..., T, J)
+        @test typeof(arr) == typeof(UnROOT.interped_data(UnROOT.readbasket(rootfile, branch, 1)..., T, J))
+        @test LazyBranch(rootfile, branch)[2:end-1] == arr[2:end-1]
+        close(rootfile)
+    end
+
+    # the output is the only allocation scaling with the branch size, besides one
+    # decompression arena per thread decoding the baskets
+    rootfile = UnROOT.samplefile("tree_with_large_array_lz4.root")
+    branch = rootfile["t1/float_array"]
+    arr = UnROOT.array(rootfile, branch)
+    arena = Base.summarysize(UnROOT.basketarray(rootfile, branch, 1))
+    @test (@allocated UnROOT.array(rootfile, branch)) < Base.summarysize(arr) + Threads.nthreads() * arena + 100_000
+    close(rootfile)
+end
+
+@testset "Multi-block decompression" begin
+    # a chain of independent blocks with different algorithms, as found in baskets/pages > 16 MiB
+    payloads = [rand(UInt8(0):UInt8(3), n) for n in (100_000, 70_000, 1, 30_000)]
+    io = IOBuffer()
+    UnROOT._write_compressed_block!(io, UnROOT.Const.kZLIB, 1, payloads[1])
+    UnROOT._write_compressed_block!(io, UnROOT.Const.kZSTD, 1, payloads[2])
+    UnROOT._write_compressed_block!(io, UnROOT.Const.kLZ4, 1, payloads[3])
+    comp = UnROOT.transcode(UnROOT.XzCompressor, payloads[4])
+    write(io, UInt8('X'), UInt8('Z'), 0x00)
+    UnROOT._write_3byte_le!(io, length(comp))
+    UnROOT._write_3byte_le!(io, length(payloads[4]))
+    write(io, comp)
+    src = take!(io)
+
+    blocks = UnROOT._scanblocks(src, sum(length, payloads))
+    @test length(blocks) == 4
+    @test [length(b.dst) for b in blocks] == length.(payloads)
+    @test String.(collect.(getfield.(blocks, :algo))) == ["ZL", "ZS", "L4", "XZ"]
+
+    dst = Vector{UInt8}(undef, sum(length, payloads))
+    @test UnROOT.decompress_blocks!(dst, src) == reduce(vcat, payloads)
+    # the source can be any contiguous view, e.g. into a memory-mapped file
+    @test UnROOT.decompress_blocks!(zero(dst), @view vcat(zeros(UInt8, 3), src)[4:end]) == dst
+
+    # every block is accounted with its own codec
+    prof = UnROOT.IOProfile()
+    UnROOT._profiled(prof, "blocks") do
+        UnROOT.decompress_blocks!(zero(dst), src)
+    end
+    @test sort(prof.stats["blocks"].codecs) == ["L4", "XZ", "ZL", "ZS"]
+    UnROOT._close!(prof)
+
+    @test_throws ErrorException UnROOT.decompress_blocks!(dst, src[1:end-10])
+    @test_throws ErrorException UnROOT.decompress_blocks!(Vector{UInt8}(undef, 100), src)
+end
@@ -37,6 +37,37 @@ end
     close(rootfile)
 end
 
+@testset "Jagged decoding kernels" begin
+    be(xs...) = collect(reinterpret(UInt8, hton.(Int32[xs...])))
+    header(n) = zeros(UInt8, n)
+    # vector<vector<int>> with a 6 bytes header per event: Int32 size + payload per inner vector
+    events = [[header(6); be(2, 1, 2); be(0)], header(6), [header(6); be(1, 3)]]
+    raw = reduce(vcat, events)
+    rawoffsets = Int32[0; cumsum(length.(events))]
+    out = UnROOT._unjaggjagg(Int32, raw, rawoffsets, 6)
+    @test out == [[[1, 2], []], [], [[3]]]
+    @test UnROOT.interped_data(copy(raw), copy(rawoffsets), Vector{Vector{Int32}}, UnROOT.Offset6jaggjagg) == out
+
+    events = [[header(10); be(4, 5)], header(10), [header(10); be(6)]]
+    raw = reduce(vcat, events)
+    rawoffsets = Int32[0; cumsum(length.(events))]
+    @test UnROOT._unjagg(Int32, raw, rawoffsets, 10) == [[4, 5], [], [6]]
+    @test UnROOT.interped_data(copy(raw), copy(rawoffsets), Vector{Int32}, UnROOT.Offsetjagg) == [[4, 5], [], [6]]
+
+    # the kernels keep the types of the generic path: rows of `Vector{Int32}` for doubly
+    # jagged baskets
+    @test typeof(out) == typeof(UnROOT.ArraysOfArrays.VectorOfVectors(Vector{Vector{Int32}}(), Int32[1]))
+    @test eltype(out[1]) == Vector{Int32}
+    rootfile = UnROOT.samplefile("tree_with_doubly_jagged.root")
+    ba = UnROOT.basketarray(rootfile, "t1/bi", 1)
+    @test typeof(ba) == typeof(out)
+    @test reduce(vcat, reduce(vcat, ba)) == Int32[2, 3, 5, 7, 9, 11, 13, 17, 19]
+    lb = LazyBranch(rootfile, "t1/bi")
+    @test eltype(lb) == SubArray{Vector{Int32}, 1, Vector{Vector{Int32}}, Tuple{UnitRange{Int64}}, true}
+    @test typeof(lb[1]) == eltype(lb)
+    close(rootfile)
+end
+
 @testset "Doubly jagged [var][fix] branches" begin
     # issue #187
     # this is vector<Int[N]>
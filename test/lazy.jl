@@ -61,3 +61,225 @@ end
     df = LazyTree(rootfile, "Events", ["nMuon", "Muon_pt"]; sink=DataFrame)
     @test df == DataFrame(t)
 end
+
+@testset "Prefetching LazyTree" begin
+    rootfile = UnROOT.samplefile("tree_with_large_array.root")
+    t = LazyTree(rootfile, "t1")
+    tp = LazyTree(rootfile, "t1"; prefetch=2)
+    @test tp.int32_array.prefetcher === tp.float_array.prefetcher
+    @test [evt.int32_array for evt in tp] == t.int32_array[1:end]
+    @test [evt.float_array for evt in tp] == t.float_array[1:end]
+    # random access falls back to the blocking path
+    @test tp.float_array[end] == t.float_array[end]
+    @test tp.float_array[1] == t.float_array[1]
+
+    # ... and the read-ahead resumes after it
+    tp = LazyTree(rootfile, "t1"; prefetch=2)
+    p = tp.float_array.prefetcher
+    slot = tp.float_array.prefetch_slot
+    @test tp.float_array[end] == t.float_array[end]
+    @test isempty(p.pending)
+    @test tp.float_array[1] == t.float_array[1]
+    @test any(((s, j),) -> s == slot && j > 1, keys(p.pending))
+    @test [evt.float_array for evt in tp] == t.float_array[1:end]
+    # the read-ahead of another thread's stream is left alone
+    UnROOT._prefetched_basketarray(p, slot, 1, 1)
+    UnROOT._prefetched_basketarray(p, slot, UnROOT.numbaskets(tp.float_array.b), 2)
+    @test any(((s, j),) -> s == slot && j > 1, keys(p.pending))
+
+    # closing the file waits for (and drops) the read-ahead in flight
+    tp = LazyTree(rootfile, "t1"; prefetch=1)
+    tp.int32_array[1]
+    close(rootfile)
+    @test isempty(tp.int32_array.prefetcher.pending)
+
+    # reading a single column of a tree with many clusters: only that branch is read ahead,
+    # the baskets left behind are dropped and the read-ahead keeps going until the end
+    rootfile = UnROOT.samplefile("tree_with_clusters.root")
+    t = LazyTree(rootfile, "t1")
+    tp = LazyTree(rootfile, "t1"; prefetch=2)
+    p = tp.b1.prefetcher
+    slot = tp.b1.prefetch_slot
+    b = tp.b1.b
+    @test length(p.clusters) > 10
+    maxbaskets = maximum(r -> length(UnROOT._basketsin(b, r)), p.clusters)
+    for (ic, r) in enumerate(p.clusters)
+        @test tp.b1[first(r)] == t.b1[first(r)]
+        @test all(((s, _),) -> s == slot, keys(p.pending))
+        @test length(p.pending) <= 2 * maxbaskets
+        @test p.pending_bytes == sum(e[2] for e in values(p.pending); init=0)
+        if ic < length(p.clusters)
+            @test any(((_, j),) -> j in UnROOT._basketsin(b, p.clusters[ic+1]), keys(p.pending))
+        end
+    end
+    @test collect(tp.b2) == t.b2[1:end]
+
+    # a budget smaller than a single basket still reads one basket ahead
+    tp = LazyTree(rootfile, "t1"; prefetch=1, prefetch_budget=1)
+    p = tp.b1.prefetcher
+    @test tp.b1[1] == t.b1[1]
+    @test length(p.pending) == 1
+    @test collect(tp.b1) == t.b1[1:end]
+    close(rootfile)
+
+    rootfile = UnROOT.samplefile("NanoAODv5_sample.root")
+    t = LazyTree(rootfile, "Events", ["nMuon", "Muon_pt"])
+    tp = LazyTree(rootfile, "Events", ["nMuon", "Muon_pt"]; prefetch=4)
+    @test sum(length(evt.Muon_pt) for evt in tp) == 878
+    @test [evt.Muon_pt for evt in tp] == t.Muon_pt[1:end]
+    close(rootfile)
+end
+
+@testset "Shared basket cache" begin
+    rootfile = UnROOT.samplefile("tree_with_large_array.root")
+    @test UnROOT.cache_info(rootfile).maxsize == 0
+    close(rootfile)
+
+    rootfile = UnROOT.samplefile("tree_with_large_array.root"; basketcache_size=256*1024^2)
+    nbaskets = UnROOT.numbaskets(rootfile["t1/float_array"])
+    t1 = LazyTree(rootfile, "t1", ["float_array"])
+    t2 = LazyTree(rootfile, "t1", ["float_array"])
+    @test collect(t1.float_array) == collect(t2.float_array)
+    info = UnROOT.cache_info(rootfile)
+    @test info.misses == nbaskets
+    @test info.hits == nbaskets
+    @test info.evictions == 0
+    @test 0 < info.size <= info.maxsize
+    # dropping everything is not an eviction
+    empty!(rootfile.basketcache)
+    @test UnROOT.cache_info(rootfile).evictions == 0
+    @test UnROOT.cache_info(rootfile).size == 0
+    close(rootfile)
+
+    # too small to hold a single basket: everything is evicted right away
+    rootfile = UnROOT.samplefile("tree_with_large_array.root"; basketcache_size=1)
+    arr = UnROOT.array(rootfile, "t1/float_array")
+    @test collect(LazyBranch(rootfile, "t1/float_array")) == arr
+    @test collect(LazyBranch(rootfile, "t1/float_array")) == arr
+    info = UnROOT.cache_info(rootfile)
+    @test info.hits == 0
+    @test info.evictions == info.misses == 2*nbaskets
+    close(rootfile)
+
+    rootfile = UnROOT.samplefile("tree_with_large_array.root"; basketcache_size=0)
+    @test collect(LazyBranch(rootfile, "t1/float_array")) == arr
+    @test UnROOT.cache_info(rootfile).misses == 0
+    close(rootfile)
+
+    # ranges (and with them `Tables.partitions` and `t[a:b]`) go through the cache as well
+    for (filename, path) in [("tree_with_large_array.root", "t1/float_array"),
+                             ("tree_with_jagged_array.root", "t1/int32_array")]
+        rootfile = UnROOT.samplefile(filename)
+        expected = UnROOT.array(rootfile, path)
+        close(rootfile)
+        rootfile = UnROOT.samplefile(filename; basketcache_size=256*1024^2)
+        lb = LazyBranch(rootfile, path)
+        nbaskets = UnROOT.numbaskets(lb.b)
+        @test lb[2:end-1] == expected[2:end-1]
+        @test typeof(lb[2:end-1]) == typeof(expected[2:end-1])
+        @test UnROOT.cache_info(rootfile).misses == nbaskets
+        @test lb[1:end] == expected
+        @test UnROOT.cache_info(rootfile).hits == nbaskets
+        close(rootfile)
+    end
+end
+
+@testset "Predicate pushdown" begin
+    # b1 = [i, i+1] and b2 = [i+1, i+2] for the i-th (0-based) row, 18 clusters
+    rootfile = UnROOT.samplefile("tree_with_clusters.root"; basketcache_size=256*1024^2)
+    t = LazyTree(rootfile, "t1")
+    idx = UnROOT.filterentries(evt -> evt.b1[1] >= 2400, t, :b1)
+    @test idx == 2401:2500
+    # the payload is only read from the baskets with surviving rows
+    @test first.(view(t, idx).b2) == 2401:2500
+    @test UnROOT.cache_info(rootfile).misses == length(UnROOT._basketsin(rootfile["t1/b2"], 2401:2500))
+    @test UnROOT.filterentries(evt -> evt.b1[1] >= 2400, t, :b1; entries=[2499, 5, 2450]) == [2450, 2499]
+    # duplicated candidates are returned once
+    @test UnROOT.filterentries(evt -> evt.b1[1] >= 2400, t, :b1; entries=[2450, 2499, 5, 2450, 2499]) == [2450, 2499]
+    @test UnROOT.filterentries(evt -> evt.b1[1] >= 2400, t, :b1; entries=[5, 2450, 2450]) == [2450]
+    @test UnROOT.filterentries(evt -> evt.b2[1] == evt.b1[2], t, (:b1, :b2)) == 1:2500
+    @test isempty(UnROOT.filterentries(_ -> false, t, [:b1]))
+    # in-memory trees work too
+    @test UnROOT.filterentries(evt -> isodd(evt.b1[1]), t[1:10], :b1) == 2:2:10
+    close(rootfile)
+
+    # the less selective the cut, the more of the payload is read (the "Pushdown" benchmark)
+    payload = map((0.01, 0.1, 0.5, 1.0)) do selectivity
+        rootfile = UnROOT.samplefile("tree_with_clusters.root"; profile=true)
+        t = LazyTree(rootfile, "t1")
+        idx = UnROOT.filterentries(evt -> evt.b1[1] >= length(t) * (1 - selectivity), t, :b1)
+        @test sum(first, view(t, idx).b2; init=0) == sum(idx; init=0)
+        close(rootfile)
+        UnROOT.io_profile(rootfile).stats["t1/b2"]
+    end
+    @test issorted(getfield.(payload, :reads)) && issorted(getfield.(payload, :bytes_decompressed))
+    @test payload[1].bytes_decompressed < payload[end].bytes_decompressed
+
+    rootfile = UnROOT.samplefile("ttreeindex.root")
+    @test UnROOT.indexentries(rootfile, "t", 1) == [2, 4]
+    @test UnROOT.indexentries(rootfile, "t", 1:2, 2) == [2, 6]
+    @test isempty(UnROOT.indexentries(rootfile, "t", 4:10))
+    t = LazyTree(rootfile, "t")
+    @test t.major[UnROOT.indexentries(rootfile, "t", 3)] == [3, 3]
+    @test UnROOT.filterentries(evt -> evt.val > 3, t, :val; entries=UnROOT.indexentries(rootfile["t"], 2:3)) == [5, 6]
+    @test_throws ErrorException UnROOT.indexentries(UnROOT.samplefile("tree_with_clusters.root"), "t1", 1)
+    # an index not sorted by its major key gives the same result
+    ti = rootfile["t"].fTreeIndex
+    shuffled = typeof(ti)(; (k => getfield(ti, k) for k in fieldnames(typeof(ti)))...,
+                          fIndexValues=reverse(ti.fIndexValues), fIndexValuesMinor=reverse(ti.fIndexValuesMinor),
+                          fIndex=reverse(ti.fIndex))
+    @test !issorted(shuffled.fIndexValues)
+    @test UnROOT.indexentries(shuffled, 1:2, 2) == UnROOT.indexentries(ti, 1:2, 2) == [2, 6]
+    @test UnROOT.indexentries(shuffled, 3) == UnROOT.indexentries(ti, 3)
+    close(rootfile)
+end
+
+@testset "I/O profile" begin
+    rootfile = UnROOT.samplefile("tree_with_large_array.root")
+    @test isnothing(UnROOT.io_profile(rootfile))
+    close(rootfile)
+
+    rootfile = UnROOT.samplefile("tree_with_large_array_lz4.root"; profile=true, basketcache_size=256*1024^2)
+    prof = UnROOT.io_profile(rootfile)
+    b = rootfile["t1/float_array"]
+    nbaskets = UnROOT.numbaskets(b)
+    arr = collect(LazyBranch(rootfile, "t1/float_array"))
+    @test collect(LazyBranch(rootfile, "t1/float_array")) == arr
+    s = prof.stats["t1/float_array"]
+    @test s.reads == s.cache_misses == s.cache_hits == nbaskets
+    @test s.bytes_read == sum(b.fBasketBytes[1:nbaskets])
+    # same on-disk accounting as the cluster size estimate
+    @test s.bytes_read == sum(UnROOT._clusterbytes([LazyBranch(rootfile, b)]; compressed=true))
+    @test s.bytes_decompressed > 0
+    @test s.codecs == ["L4"]
+    @test s.ns_read >= 0 && s.ns_decompress > 0 && s.ns_decode > 0
+    @test !haskey(prof.stats, "t1/int32_array")
+
+    cols = UnROOT.Tables.columns(prof)
+    @test cols.name == ["t1/float_array"]
+    @test cols.reads == [nbaskets]
+    @test occursin("t1/float_array", repr(MIME"text/plain"(), prof))
+    empty!(prof)
+    @test isempty(prof.stats)
+
+    # whole branches, raw reads and ranges of baskets are accounted too
+    for read in (() -> UnROOT.array(rootfile, b), () -> UnROOT.array(rootfile, b; raw=true),
+                 () -> LazyBranch(rootfile, b)[1:end])
+        read()
+        s = prof.stats["t1/float_array"]
+        @test s.reads == nbaskets
+        @test s.bytes_decompressed > 0 && s.ns_decode > 0
+        empty!(prof)
+    end
+    close(rootfile)
+    @test !prof.active[]
+
+    # same-named branches of different trees are accounted apart
+    rootfile = UnROOT.samplefile("issue7.root"; profile=true)
+    prof = UnROOT.io_profile(rootfile)
+    @test UnROOT.array(rootfile, "TreeD/nums") == collect(LazyTree(rootfile, "TreeF").nums)
+    @test issubset(["TreeD/nums", "TreeF/nums"], keys(prof.stats))
+    @test !haskey(prof.stats, "nums")
+    @test prof.stats["TreeD/nums"].reads >= 1 && prof.stats["TreeF/nums"].reads >= 1
+    close(rootfile)
+end
@@ -75,3 +75,49 @@ end
     rootfile = UnROOT.samplefile("TVectorT-double_on_top_level.root")
     @test [1.1, 2.2, 3.3] == rootfile["vector_double"]
 end
+
+@testset "Lazy metadata and metadata index" begin
+    path = joinpath(mktempdir(), "nanoaod.unrootindex")
+    f = UnROOT.samplefile("NanoAODv5_sample.root")
+    # the streamers are not needed for plain branches
+    t = LazyTree(f, "Events", ["nMuon", r"^Muon_(pt|eta)$"])
+    @test isnothing(@atomic f.streamers.parsed)
+    muon_pt = collect(t.Muon_pt)
+    nstreamers = length(f.streamers)
+    @test !isnothing(@atomic f.streamers.parsed)
+    @test UnROOT.write_metadata_index(f, path) == path
+    seeks = f["Events/Muon_pt"].fBasketSeek
+    close(f)
+
+    f = UnROOT.samplefile("NanoAODv5_sample.root"; metadata_index=path)
+    @test haskey(f.cache, "Events")
+    @test !isnothing(@atomic f.streamers.parsed)
+    @test length(f.streamers) == nstreamers
+    @test f["Events/Muon_pt"].fBasketSeek == seeks
+    t = LazyTree(f, "Events", ["nMuon", r"^Muon_(pt|eta)$"])
+    @test collect(t.Muon_pt) == muon_pt
+    close(f)
+
+    # the index belongs to one file only
+    f = UnROOT.samplefile("tree_with_large_array.root"; metadata_index=path)
+    @test isempty(f.cache)
+    @test isnothing(@atomic f.streamers.parsed)
+    close(f)
+    # and a missing one is ignored
+    f = UnROOT.samplefile("tree_with_large_array.root"; metadata_index=true)
+    @test length(LazyTree(f, "t1")) == 100000
+    close(f)
+
+    # the default index sits next to the file, which must not have changed since
+    filename = joinpath(mktempdir(), "large_array.root")
+    cp(joinpath(@__DIR__, "samples", "tree_with_large_array.root"), filename)
+    @test ROOTFile(UnROOT.write_metadata_index, filename) == filename * ".unrootindex"
+    f = ROOTFile(filename; metadata_index=true)
+    @test haskey(f.cache, "t1")
+    close(f)
+    open(io -> write(io, 0x00), filename, "a")
+    f = ROOTFile(filename; metadata_index=true)
+    @test isempty(f.cache)
+    @test length(LazyTree(f, "t1")) == 100000
+    close(f)
+end
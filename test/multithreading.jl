@@ -87,3 +87,28 @@ t = LazyTree(UnROOT.samplefile("NanoAODv5_sample.root"), "Events", ["Muon_pt"])
         @test sum([length(inds[i] ∩ inds[j]) for i=1:length(inds), j=1:length(inds) if j>i]) == 0
     end
 end
+
+@testset "Parallel basket decoding" begin
+    # whole branches and multi-basket ranges decode their baskets on all threads
+    for (filename, path) in [("tree_with_large_array_lz4.root", "t1/float_array"),
+                             ("tree_with_jagged_array.root", "t1/int32_array")]
+        rootfile = UnROOT.samplefile(filename)
+        branch = rootfile[path]
+        @test UnROOT.numbaskets(branch) > 1
+        T, J = UnROOT.auto_T_JaggT(rootfile, branch; customstructs=rootfile.customstructs)
+        arr = UnROOT.array(rootfile, branch)
+        @test arr == UnROOT.interped_data(UnROOT.readbranchraw(rootfile, branch)..., T, J)
+        @test typeof(arr) == typeof(UnROOT.basketarray(rootfile, branch, 1))
+        @test UnROOT.basketarray(rootfile, branch, 2:3) == reduce(vcat, (collect(UnROOT.basketarray(rootfile, branch, i)) for i in 2:3))
+        close(rootfile)
+    end
+
+    rootfile = UnROOT.samplefile("tree_with_large_array_lz4.root")
+    branch = rootfile["t1/float_array"]
+    tids = UnROOT._mapbaskets(_ -> (sleep(0.01); Threads.threadid()), rootfile, branch, 4nthreads)
+    @test length(tids) == 4nthreads
+    if nthreads > 1
+        @test length(unique(tids)) > 1
+    end
+    close(rootfile)
+end
@@ -83,6 +83,28 @@ end
     @test length(df.one_integers) == 50000000 * 2
 end
 
+@testset "RNTuple shared cluster cache" begin
+    f1 = UnROOT.samplefile("RNTuple/test_ntuple_int_5e4.root"; basketcache_size=256*1024^2)
+    df1 = LazyTree(f1, "ntuple")
+    df2 = LazyTree(f1, "ntuple")
+    @test collect(df1.one_integers) == collect(df2.one_integers)
+    info = UnROOT.cache_info(f1)
+    @test info.misses > 0
+    @test info.hits == info.misses
+end
+
+@testset "RNTuple predicate pushdown" begin
+    # two clusters of 100 entries: [i, i] then [i, i+1]
+    f1 = UnROOT.samplefile("RNTuple/test_index_multicluster_rntuple_v1-0-0-0.root")
+    df = LazyTree(f1, "ntuple")
+    @test UnROOT.filterentries(evt -> evt.int_vector[1] != evt.int_vector[2], df, :int_vector) == 101:200
+    f2 = UnROOT.samplefile("RNTuple/test_index_multicluster_rntuple_v1-0-0-0.root"; basketcache_size=256*1024^2)
+    df = LazyTree(f2, "ntuple")
+    @test UnROOT.filterentries(evt -> evt.int_vector[1] > 10, df, :int_vector; entries=[150, 190]) == [150, 190]
+    # the first cluster has no candidates and is never read
+    @test UnROOT.cache_info(f2).misses == 1
+end
+
 @testset "RNTuple std:: container types" begin
     f1 = UnROOT.samplefile("RNTuple/test_ntuple_stl_containers.root")
     df = LazyTree(f1, "ntuple")
@@ -326,3 +348,17 @@ end
         @test collect(t.Cost)[end] == 12716
     end
 end
+
+@testset "RNTuple I/O profile" begin
+    f = UnROOT.samplefile("RNTuple/ntpl001_staff_rntuple_v1-0-0-0.root"; profile=true, basketcache_size=256*1024^2)
+    prof = UnROOT.io_profile(f)
+    divisions = collect(LazyTree(f, "Staff").Division)
+    @test collect(LazyTree(f, "Staff").Division) == divisions
+    s = prof.stats["Staff/Division"]
+    @test s.cache_misses == s.cache_hits >= 1
+    # strings have an offset and a character column
+    @test s.reads >= 2
+    @test s.bytes_read > 0
+    @test !haskey(prof.stats, "Staff/Nation")
+    close(f)
+end
@@ -15,6 +15,7 @@ nthreads == 1 && @warn "Running on a single thread. Please re-run the test suite
     include("views.jl")
     include("multithreading.jl")
     include("remote.jl")
+    include("coalesced_reads.jl")
     include("displays.jl")
     include("type_stability.jl")
     include("utils.jl")